@@ -16,6 +16,13 @@ namespace wfe::editor {
     typedef void(*SaveCallback)();
     typedef void(*CloseCallback)();
 
+    /// @brief Tracks when a window's periodically refreshed values were last refreshed.
+    struct WindowRefreshTimer {
+        float64_t lastRefreshTime;
+    };
+
+    const float64_t WINDOW_REFRESH_INTERVAL = 0.5; // The default interval at which windows refresh their displayed values, in seconds
+
     /// @brief Loads the current workspace dir and the other recent dirs.
     void LoadWorkspace();
     /// @brief Saves the current workspace dir and the other recent dirs.
@@ -42,6 +49,16 @@ namespace wfe::editor {
     void SetWorkspaceDir(const string& newWorkspaceDir, bool8_t removeFromRecents = true);
     /// @brief Closes the current workspace.
     void CloseWorkspace();
+
+    /// @brief Checks if a window's displayed values are due for a refresh and wakes up the main loop for the next one.
+    /// Values that change every frame would keep the editor from idling, so they should only be refreshed when this returns true.
+    /// @param timer The window's refresh timer.
+    /// @param interval The interval between refreshes, in seconds.
+    /// @return True if the values should be refreshed this frame, otherwise false.
+    bool8_t ShouldRefreshWindow(WindowRefreshTimer& timer, float64_t interval = WINDOW_REFRESH_INTERVAL);
+    /// @brief Calculates how long the main loop can idle before a window's values need to be refreshed. Meant for internal use.
+    /// @return The refresh timeout in seconds, or a negative value if no refresh is due.
+    float64_t GetWindowRefreshTimeout();
 }
 
 // Macro for creating the window type
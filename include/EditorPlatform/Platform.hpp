@@ -57,6 +57,11 @@ namespace wfe::editor {
     void DeletePlatform();
     /// @brief Polls all new platform events. Meant for internal use.
     void PollPlatformEvents();
+    /// @brief Blocks until a platform event arrives, the platform is woken up or the timeout expires. Meant for internal use.
+    /// @param timeout The maximum time to wait for, in seconds. A negative value waits indefinitely.
+    void WaitPlatformEvents(float64_t timeout);
+    /// @brief Wakes up the main loop if it is waiting for platform events. Safe to call from any thread.
+    void WakePlatform();
 
     /// @brief Gets the platform info.
     /// @return A pointer to the platform info.
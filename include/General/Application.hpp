@@ -95,16 +95,29 @@ namespace wfe::editor {
     /// @return A vector with every wanted event.
     vector<Event> GetEventsOfType(EventType type);
 
-    /// @brief Adds an event to the queue to be processed next frame.
+    /// @brief Adds an event to the queue to be processed next frame, waking up the main loop if it is idling.
     /// @param event The event to add to the queue.
     void AddEvent(Event event);
 
+    /// @brief Keeps the main loop from idling after the current frame and wakes it up if it is already idling. Should be called every frame while a window is animating.
+    void RequestContinuousUpdates();
+
+    /// @brief Gets the frame rate the main loop is limited to.
+    /// @return The target frame rate, or 0 if the frame rate is uncapped.
+    uint32_t GetTargetFrameRate();
+    /// @brief Limits the main loop's frame rate.
+    /// @param newTargetFrameRate The new target frame rate, or 0 to uncap the frame rate.
+    void SetTargetFrameRate(uint32_t newTargetFrameRate);
+
     /// @brief Exits the application.
     /// @param returnCode The final return code.
     void CloseApplication(int32_t returnCode);
     /// @brief Whether the program is running inside the editor.
     /// @return If the program is running insize the editor or not.
     bool8_t IsInsideEditor();
+    /// @brief Whether the editor is running without a window, rendering into an offscreen image.
+    /// @return True if the editor was started with --headless, otherwise false.
+    bool8_t IsHeadless();
 
     /// @brief Gets the width of the main window.
     /// @return The width of the main window.
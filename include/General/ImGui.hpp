@@ -6,10 +6,15 @@
 namespace wfe::editor {
     /// @brief Creates the ImGui context. Internal use only.
     void CreateImGui();
+    /// @brief Rasterizes the loaded fonts into the font atlas. Can run on any thread while nothing else uses ImGui. Internal use only.
+    void BakeImGuiFonts();
     /// @brief Deletes the ImGui context. Internal use only.
     void DeleteImGui();
     /// @brief Processes any ImGui relevant events. Meant for internal use.
     void ProcessImGuiEvents();
+    /// @brief Calculates how long the main loop can idle before one of ImGui's timers or a window refresh needs a new frame. Meant for internal use.
+    /// @return The idle timeout, in seconds.
+    float64_t GetImGuiIdleTimeout();
 
     /// @brief Gets the ImGui context.
     /// @return A pointer to the ImGui context.
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace wfe::editor {
+    /// @brief Writes the given pixels to an uncompressed PNG file.
+    /// @param filename The name of the file to write to.
+    /// @param width The width of the image, in pixels.
+    /// @param height The height of the image, in pixels.
+    /// @param data The image's RGBA8 pixel data, with rows stored from top to bottom.
+    /// @return True if the file was written successfully, otherwise false.
+    bool8_t WritePNGFile(const string& filename, size_t width, size_t height, const void* data);
+}
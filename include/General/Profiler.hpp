@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Core.hpp"
+
+// Profiler zones are compiled out of release builds, unless explicitly enabled
+#ifndef WFE_ENABLE_PROFILER
+#ifdef NDEBUG
+#define WFE_ENABLE_PROFILER 0
+#else
+#define WFE_ENABLE_PROFILER 1
+#endif
+#endif
+
+namespace wfe::editor {
+    /// @brief Holds info about a zone recorded by the profiler.
+    struct ProfilerZoneInfo {
+        /// @brief The name of the zone.
+        const char_t* name;
+        /// @brief The time the zone started at, in milliseconds, relative to the start of its frame.
+        float64_t start;
+        /// @brief The time spent in the zone, in milliseconds.
+        float64_t duration;
+        /// @brief The number of zones the zone is nested in.
+        uint32_t depth;
+        /// @brief The index of the thread the zone was recorded on.
+        uint32_t threadIndex;
+    };
+
+    /// @brief Deletes every thread's zone buffer. Must be called after every other thread stopped. Internal use only.
+    void DeleteProfiler();
+
+    /// @brief Sets the name the current thread is displayed with.
+    /// @param name The name of the thread. It is copied, so it doesn't need to outlive the call.
+    void SetProfilerThreadName(const char_t* name);
+    /// @brief Returns the number of threads that recorded at least one zone.
+    size_t GetProfilerThreadCount();
+    /// @brief Returns the name of the thread with the given index.
+    const char_t* GetProfilerThreadName(size_t threadIndex);
+
+    /// @brief Returns a copy of the given name that lives as long as the editor. Lets zones use names that may change or be freed.
+    /// @param name The name to copy.
+    /// @return The stored copy of the name. The same name always returns the same pointer.
+    const char_t* InternProfilerName(const char_t* name);
+
+    /// @brief Starts a zone on the current thread. Prefer the WFE_PROFILE_ZONE macro.
+    /// @param name The name of the zone. Must outlive the editor; use InternProfilerName for temporary names.
+    void BeginProfilerZone(const char_t* name);
+    /// @brief Ends the last zone started on the current thread.
+    void EndProfilerZone();
+    /// @brief Marks the start of a new frame. Internal use only.
+    void MarkProfilerFrame();
+
+    /// @brief Gets every zone recorded during the last completed frame.
+    /// @param zones The vector to write the zones to, sorted by thread and start time.
+    /// @return The duration of the frame, in milliseconds, or 0 if no frame was completed yet.
+    float64_t GetLastProfilerFrame(vector<ProfilerZoneInfo>& zones);
+    /// @brief Writes every zone still held by the profiler to a Chrome trace JSON file, which can be opened in Perfetto or chrome://tracing.
+    /// @param filename The name of the file to write to.
+    /// @return True if the file was written successfully, otherwise false.
+    bool8_t ExportProfilerTrace(const string& filename);
+
+    /// @brief Starts a zone when created and ends it when destroyed.
+    struct ProfilerZone {
+        ProfilerZone(const char_t* name) {
+            BeginProfilerZone(name);
+        }
+        ProfilerZone(const ProfilerZone&) = delete;
+        ProfilerZone& operator=(const ProfilerZone&) = delete;
+        ~ProfilerZone() {
+            EndProfilerZone();
+        }
+    };
+}
+
+// Helper macros for creating unique zone variable names
+#define WFE_PROFILER_CONCAT_INNER(a, b) a##b
+#define WFE_PROFILER_CONCAT(a, b) WFE_PROFILER_CONCAT_INNER(a, b)
+
+#if WFE_ENABLE_PROFILER
+// Macro for profiling the rest of the current scope; the name must be a string literal or outlive the editor
+#define WFE_PROFILE_ZONE(name) wfe::editor::ProfilerZone WFE_PROFILER_CONCAT(profilerZone, __LINE__)(name)
+// Macro for profiling the rest of the current scope with a name that may change or be freed
+#define WFE_PROFILE_ZONE_DYNAMIC(name) wfe::editor::ProfilerZone WFE_PROFILER_CONCAT(profilerZone, __LINE__)(wfe::editor::InternProfilerName(name))
+// Macro for profiling the rest of the current function
+#define WFE_PROFILE_FUNCTION() WFE_PROFILE_ZONE(__func__)
+#else
+#define WFE_PROFILE_ZONE(name)
+#define WFE_PROFILE_ZONE_DYNAMIC(name)
+#define WFE_PROFILE_FUNCTION()
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace wfe::editor {
+    /// @brief A function called once for every index of a parallel for.
+    /// @param index The index the function is called for.
+    /// @param userData The user data given to the parallel for.
+    typedef void(*ParallelForFunction)(size_t index, void* userData);
+
+    /// @brief Creates the worker threads. Internal use only.
+    void CreateThreadPool();
+    /// @brief Joins and deletes the worker threads. Internal use only.
+    void DeleteThreadPool();
+
+    /// @brief Returns the number of worker threads, not including the main thread.
+    size_t GetWorkerThreadCount();
+    /// @brief Calls the given function for every index from 0 to count on the worker threads and the calling thread.
+    /// @param count The number of indices.
+    /// @param function The function to call for every index. It must be safe to call from any thread and it must not start another parallel for.
+    /// @param userData The user data to pass to the function.
+    void ParallelFor(size_t count, ParallelForFunction function, void* userData);
+}
@@ -3,9 +3,16 @@
 #include "Core.hpp"
 #include "Base/Window.hpp"
 #include "General/Application.hpp"
+#include "General/ThreadPool.hpp"
+#include "General/ImageWriter.hpp"
+#include "General/Profiler.hpp"
 #include "EditorPlatform/Platform.hpp"
 #include "Vulkan/Device.hpp"
+#include "Vulkan/SwapChain.hpp"
 #include "Vulkan/ImGuiPipeline.hpp"
+#include "Vulkan/GPUTimings.hpp"
+#include "Vulkan/MemoryAllocator.hpp"
+#include "Vulkan/HostAllocator.hpp"
 
 #if defined(PLATFORM_WINDOWS)
 #include <windows.h>
@@ -30,6 +37,8 @@ namespace wfe::editor {
     typedef void(*PtrFn_SetWorkspaceDir)(const string&, bool8_t);
     typedef void(*PtrFn_CloseWorkspace)();
 
+    typedef bool8_t(*PtrFn_ShouldRefreshWindow)(WindowRefreshTimer&, float64_t);
+
     // General/Application.hpp
     typedef vector<Event>(*PtrFn_GetEvents)();
     typedef vector<Event>(*PtrFn_GetEventsOfType)(EventType);
@@ -37,7 +46,11 @@ namespace wfe::editor {
     typedef void(*PtrFn_AddEvent)(Event);
 
     typedef void(*PtrFn_CloseApplication)(int32_t);
+    typedef void(*PtrFn_RequestContinuousUpdates)();
+    typedef uint32_t(*PtrFn_GetTargetFrameRate)();
+    typedef void(*PtrFn_SetTargetFrameRate)(uint32_t);
     typedef bool8_t(*PtrFn_IsInsideEditor)();
+    typedef bool8_t(*PtrFn_IsHeadless)();
 
     typedef size_t(*PtrFn_GetMainWindowWidth)();
     typedef size_t(*PtrFn_GetMainWindowHeight)();
@@ -49,6 +62,7 @@ namespace wfe::editor {
     typedef void(*PtrFn_CreateImGui)();
     typedef void(*PtrFn_DeleteImGui)();
     typedef void(*PtrFn_ProcessImGuiEvents)();
+    typedef float64_t(*PtrFn_GetImGuiIdleTimeout)();
 
     typedef ImGuiContext*(*PtrFn_GetImGuiContext)();
     typedef ImGuiIO*(*PtrFn_GetImGuiIO)();
@@ -58,10 +72,32 @@ namespace wfe::editor {
     typedef ImFont*(*PtrFn_GetImGuiBoldFont)();
     typedef ImFont*(*PtrFn_GetImGuiItalicFont)();
 
+    // General/ThreadPool.hpp
+    typedef void(*PtrFn_CreateThreadPool)();
+    typedef void(*PtrFn_DeleteThreadPool)();
+
+    typedef size_t(*PtrFn_GetWorkerThreadCount)();
+    typedef void(*PtrFn_ParallelFor)(size_t, ParallelForFunction, void*);
+
+    // General/ImageWriter.hpp
+    typedef bool8_t(*PtrFn_WritePNGFile)(const string&, size_t, size_t, const void*);
+
+    // General/Profiler.hpp
+    typedef void(*PtrFn_SetProfilerThreadName)(const char_t*);
+    typedef size_t(*PtrFn_GetProfilerThreadCount)();
+    typedef const char_t*(*PtrFn_GetProfilerThreadName)(size_t);
+    typedef const char_t*(*PtrFn_InternProfilerName)(const char_t*);
+    typedef void(*PtrFn_BeginProfilerZone)(const char_t*);
+    typedef void(*PtrFn_EndProfilerZone)();
+    typedef float64_t(*PtrFn_GetLastProfilerFrame)(vector<ProfilerZoneInfo>&);
+    typedef bool8_t(*PtrFn_ExportProfilerTrace)(const string&);
+
     // Platform/Platform.hpp
     typedef void(*PtrFn_CreatePlatform)();
     typedef void(*PtrFn_DeletePlatform)();
     typedef void(*PtrFn_PollPlatformEvents)();
+    typedef void(*PtrFn_WaitPlatformEvents)(float64_t);
+    typedef void(*PtrFn_WakePlatform)();
 
     typedef PlatformInfo*(*PtrFn_GetPlatformInfo)();
 
@@ -83,8 +119,17 @@ namespace wfe::editor {
     typedef VkSurfaceKHR(*PtrFn_GetSurface)();
     typedef VkQueue(*PtrFn_GetGraphicsQueue)();
     typedef VkQueue(*PtrFn_GetPresentQueue)();
+    typedef VkQueue(*PtrFn_GetTransferQueue)();
+    typedef VkResult(*PtrFn_SubmitToQueue)(VkQueue, uint32_t, const VkSubmitInfo*, VkFence);
+    typedef void(*PtrFn_WaitForQueueIdle)(VkQueue);
+    typedef void(*PtrFn_WaitForDeviceIdle)();
+    typedef VkPipelineCache(*PtrFn_GetPipelineCache)();
     typedef const VkPhysicalDeviceProperties&(*PtrFn_GetPhysicalDeviceProperties)();
     typedef const VkPhysicalDeviceFeatures&(*PtrFn_GetPhysicalDeviceFeatures)();
+    typedef const VkPhysicalDeviceDescriptorIndexingFeaturesEXT&(*PtrFn_GetDescriptorIndexingFeatures)();
+    typedef bool8_t(*PtrFn_IsDeviceExtensionEnabled)(const char_t* extensionName);
+    typedef bool8_t(*PtrFn_IsDynamicRenderingSupported)();
+    typedef bool8_t(*PtrFn_IsTimelineSemaphoreSupported)();
     typedef bool8_t(*PtrFn_AreValidationLayersEnabled)();
     typedef void(*PtrFn_EnableValidationLayers)();
     typedef void(*PtrFn_DisableValidationLayers)();
@@ -97,8 +142,28 @@ namespace wfe::editor {
 
     typedef void(*PtrFn_CreateBuffer)(VkDeviceSize, VkBufferUsageFlags, VkMemoryPropertyFlags, VkBuffer&, VkDeviceMemory&);
     typedef void(*PtrFn_CreateImage)(const VkImageCreateInfo&, VkMemoryPropertyFlags, VkImage&, VkDeviceMemory&);
+    typedef void(*PtrFn_CreateBufferAllocation)(VkDeviceSize, VkBufferUsageFlags, VkMemoryPropertyFlags, VkBuffer&, MemoryAllocation&);
+    typedef void(*PtrFn_CreateImageAllocation)(const VkImageCreateInfo&, VkMemoryPropertyFlags, VkImage&, MemoryAllocation&);
+    typedef VkCommandBuffer(*PtrFn_BeginCommandBatch)();
+    typedef uint64_t(*PtrFn_SubmitCommandBatch)(VkCommandBuffer);
+    typedef bool8_t(*PtrFn_IsCommandBatchComplete)(uint64_t);
+    typedef void(*PtrFn_WaitForCommandBatch)(uint64_t);
     typedef VkCommandBuffer(*PtrFn_BeginSingleTimeCommands)();
+    typedef uint64_t(*PtrFn_UploadImageData)(VkImage image, uint32_t width, uint32_t height, const void* data, VkDeviceSize size);
+    typedef void(*PtrFn_SubmitUploads)();
+    typedef bool8_t(*PtrFn_IsUploadComplete)(uint64_t upload);
+    typedef void(*PtrFn_WaitForUpload)(uint64_t upload);
+    typedef bool8_t(*PtrFn_HasPendingUploads)();
+    typedef void(*PtrFn_DeferDestroyBuffer)(VkBuffer);
+    typedef void(*PtrFn_DeferDestroyImage)(VkImage);
+    typedef void(*PtrFn_DeferDestroyImageView)(VkImageView);
+    typedef void(*PtrFn_DeferFreeMemory)(VkDeviceMemory);
+    typedef void(*PtrFn_DeferFreeMemoryAllocation)(const MemoryAllocation&);
+    typedef void(*PtrFn_DeferFreeDescriptorSet)(VkDescriptorPool, VkDescriptorSet);
+    typedef void(*PtrFn_DeferDestroyPipeline)(VkPipeline);
+    typedef size_t(*PtrFn_GetDeferredDeletionCount)();
     typedef void(*PtrFn_EndSingleTimeCommands)(VkCommandBuffer);
+    typedef VkCommandBuffer(*PtrFn_AllocateFrameCommandBuffer)(uint32_t);
     typedef void(*PtrFn_CopyBuffer)(VkBuffer, VkBuffer, VkDeviceSize, VkCommandBuffer);
     typedef void(*PtrFn_CopyImage)(VkImage, VkImage, uint32_t, uint32_t, uint32_t, uint32_t, VkCommandBuffer);
     typedef void(*PtrFn_CopyBufferToImage)(VkBuffer, VkImage, uint32_t, uint32_t, uint32_t, VkCommandBuffer);
@@ -111,17 +176,73 @@ namespace wfe::editor {
     typedef void(*PtrFn_CreateImGuiPipeline)();
     typedef void(*PtrFn_DeleteImGuiPipeline)();
     typedef void(*PtrFn_DrawImGui)();
+    typedef bool8_t(*PtrFn_HasImGuiFrameChanged)();
+    typedef void(*PtrFn_RequestRedraw)();
+    typedef bool8_t(*PtrFn_IsPresentOnChangeEnabled)();
+    typedef void(*PtrFn_EnablePresentOnChange)();
+    typedef void(*PtrFn_DisablePresentOnChange)();
+    typedef bool8_t(*PtrFn_IsBindlessRenderingEnabled)();
+    typedef void(*PtrFn_EnableBindlessRendering)();
+    typedef void(*PtrFn_DisableBindlessRendering)();
 
     typedef VkPipeline(*PtrFn_GetImGuiPipeline)();
     typedef VkPipelineLayout(*PtrFn_GetImGuiPipelineLayout)();
     typedef VkCommandBuffer(*PtrFn_GetImGuiCommandBuffer)();
+    typedef const ImGuiPipelineStats&(*PtrFn_GetImGuiPipelineStats)();
+
+    typedef ImGuiTextureRegion(*PtrFn_GetImGuiTexture)(ImageID);
+    typedef void(*PtrFn_LoadImGuiIcons)(size_t count, const char_t* const* filenames, ImGuiTextureRegion* regions);
+    typedef ImTextureID(*PtrFn_RegisterImGuiTexture)(size_t width, size_t height, const void* data);
+    typedef void(*PtrFn_LoadImGuiTextures)(size_t count, const char_t* const* filenames, ImTextureID* textureIds);
+    typedef void(*PtrFn_LoadImGuiTexturesFromMemory)(size_t count, const void* const* encodedData, const size_t* encodedSizes, ImTextureID* textureIds);
+    typedef void(*PtrFn_UpdateImGuiTexture)(ImTextureID textureId, size_t width, size_t height, const void* data);
+    typedef void(*PtrFn_ReleaseImGuiTexture)(ImTextureID textureId);
+
+    // Vulkan/GPUTimings.hpp
+    typedef bool8_t(*PtrFn_AreGPUTimingsSupported)();
+    typedef bool8_t(*PtrFn_AreWindowGPUTimingsEnabled)();
+    typedef void(*PtrFn_EnableWindowGPUTimings)();
+    typedef void(*PtrFn_DisableWindowGPUTimings)();
+
+    typedef uint32_t(*PtrFn_BeginGPUScope)(VkCommandBuffer commandBuffer, const char_t* name);
+    typedef void(*PtrFn_EndGPUScope)(VkCommandBuffer commandBuffer, uint32_t scope);
+
+    typedef const vector<GPUTiming>&(*PtrFn_GetGPUTimings)();
+
+    // Vulkan/MemoryAllocator.hpp
+    typedef void(*PtrFn_AllocateMemory)(const VkMemoryRequirements&, VkMemoryPropertyFlags, bool8_t, MemoryAllocation&);
+    typedef void(*PtrFn_FreeMemory)(MemoryAllocation&);
+    typedef void(*PtrFn_FlushMemory)(const MemoryAllocation&, VkDeviceSize, VkDeviceSize);
+
+    typedef MemoryAllocatorStats(*PtrFn_GetMemoryAllocatorStats)();
 
-    typedef ImTextureID(*PtrFn_GetImGuiTexture)(ImageID);
+    // Vulkan/HostAllocator.hpp
+    typedef bool8_t(*PtrFn_IsHostAllocatorEnabled)();
+    typedef HostAllocatorStats(*PtrFn_GetHostAllocatorStats)();
+    typedef const char_t*(*PtrFn_HostAllocationScopeToString)(VkSystemAllocationScope);
 
     // Vulkan/SwapChain.hpp
     typedef void(*PtrFn_CreateSwapChain)();
     typedef void(*PtrFn_DeleteSwapChain)();
     typedef void(*PtrFn_RecreateSwapChain)();
+    typedef void(*PtrFn_RequestSwapChainRecreation)();
+    typedef bool8_t(*PtrFn_IsSwapChainRecreationPending)();
+    typedef bool8_t(*PtrFn_UpdateSwapChain)();
+    typedef const SwapChainStats&(*PtrFn_GetSwapChainStats)();
+
+    typedef const SwapChainAttachmentInfo&(*PtrFn_GetSwapChainAttachmentInfo)();
+    typedef void(*PtrFn_SetSwapChainAttachmentInfo)(const SwapChainAttachmentInfo&);
+    typedef uint32_t(*PtrFn_GetSwapChainAttachmentCount)();
+    typedef bool8_t(*PtrFn_IsDynamicRenderingEnabled)();
+    typedef const VkPipelineRenderingCreateInfoKHR*(*PtrFn_GetPipelineRenderingCreateInfo)();
+    typedef void(*PtrFn_BeginSwapChainRendering)(VkCommandBuffer, uint32_t, const VkClearValue*);
+    typedef void(*PtrFn_EndSwapChainRendering)(VkCommandBuffer, uint32_t);
+    typedef bool8_t(*PtrFn_IsTimelineSemaphoreEnabled)();
+    typedef VkSemaphore(*PtrFn_GetFrameTimelineSemaphore)();
+    typedef uint64_t(*PtrFn_GetSubmittedFrameValue)();
+    typedef uint64_t(*PtrFn_GetCompletedFrameValue)();
+    typedef bool8_t(*PtrFn_HasGPUReachedFrame)(uint64_t);
+    typedef void(*PtrFn_WaitForFrame)(uint64_t);
 
     typedef VkFramebuffer(*PtrFn_GetFrameBuffer)(size_t);
     typedef VkRenderPass(*PtrFn_GetRenderPass)();
@@ -132,12 +253,21 @@ namespace wfe::editor {
     typedef size_t(*PtrFn_GetSwapChainWidth)();
     typedef size_t(*PtrFn_GetSwapChainHeight)();
     typedef uint32_t(*PtrFn_GetCurrentFrame)();
+    typedef VkPresentModeKHR(*PtrFn_GetPresentMode)();
+    typedef VkPresentModeKHR(*PtrFn_GetPreferredPresentMode)();
+    typedef void(*PtrFn_SetPreferredPresentMode)(VkPresentModeKHR);
+    typedef uint32_t(*PtrFn_GetPreferredImageCount)();
+    typedef void(*PtrFn_SetPreferredImageCount)(uint32_t);
+    typedef const char_t*(*PtrFn_PresentModeToString)(VkPresentModeKHR);
+    typedef bool8_t(*PtrFn_StringToPresentMode)(const char_t*, VkPresentModeKHR&);
 
     typedef float32_t(*PtrFn_ExtentAspectRatio)();
     typedef VkFormat(*PtrFn_FindDepthFormat)();
     
     typedef VkResult(*PtrFn_AcquireNextImage)(uint32_t*);
+    typedef void(*PtrFn_QueueFrameCommandBuffer)(VkCommandBuffer);
     typedef VkResult(*PtrFn_SubmitCommandBuffers)(const VkCommandBuffer*, uint32_t*, uint32_t);
+    typedef bool8_t(*PtrFn_ReadLastFramePixels)(void*);
 
     // Windows/EditorPropertiesWindow.hpp
     typedef void(*PtrFn_LoadEditorProperties)();
@@ -168,13 +298,19 @@ namespace wfe::editor {
         PtrFn_SetWorkspaceDir setWorkspaceDir;
         PtrFn_CloseWorkspace closeWorkspace;
 
+        PtrFn_ShouldRefreshWindow shouldRefreshWindow;
+
         PtrFn_GetEvents getEvents;
         PtrFn_GetEventsOfType getEventsOfType;
 
         PtrFn_AddEvent addEvent;
 
         PtrFn_CloseApplication closeApplication;
+        PtrFn_RequestContinuousUpdates requestContinuousUpdates;
+        PtrFn_GetTargetFrameRate getTargetFrameRate;
+        PtrFn_SetTargetFrameRate setTargetFrameRate;
         PtrFn_IsInsideEditor isInsideEditor;
+        PtrFn_IsHeadless isHeadless;
 
         PtrFn_GetMainWindowWidth getMainWindowWidth;
         PtrFn_GetMainWindowHeight getMainWindowHeight;
@@ -185,6 +321,7 @@ namespace wfe::editor {
         PtrFn_CreateImGui createImGui;
         PtrFn_DeleteImGui deleteImGui;
         PtrFn_ProcessImGuiEvents processImGuiEvents;
+        PtrFn_GetImGuiIdleTimeout getImGuiIdleTimeout;
 
         PtrFn_GetImGuiContext getImGuiContext;
         PtrFn_GetImGuiIO getImGuiIO;
@@ -194,9 +331,28 @@ namespace wfe::editor {
         PtrFn_GetImGuiBoldFont getImGuiBoldFont;
         PtrFn_GetImGuiItalicFont getImGuiItalicFont;
 
+        PtrFn_CreateThreadPool createThreadPool;
+        PtrFn_DeleteThreadPool deleteThreadPool;
+
+        PtrFn_GetWorkerThreadCount getWorkerThreadCount;
+        PtrFn_ParallelFor parallelFor;
+
+        PtrFn_WritePNGFile writePNGFile;
+
+        PtrFn_SetProfilerThreadName setProfilerThreadName;
+        PtrFn_GetProfilerThreadCount getProfilerThreadCount;
+        PtrFn_GetProfilerThreadName getProfilerThreadName;
+        PtrFn_InternProfilerName internProfilerName;
+        PtrFn_BeginProfilerZone beginProfilerZone;
+        PtrFn_EndProfilerZone endProfilerZone;
+        PtrFn_GetLastProfilerFrame getLastProfilerFrame;
+        PtrFn_ExportProfilerTrace exportProfilerTrace;
+
         PtrFn_CreatePlatform createPlatform;
         PtrFn_DeletePlatform deletePlatform;
         PtrFn_PollPlatformEvents pollPlatformEvents;
+        PtrFn_WaitPlatformEvents waitPlatformEvents;
+        PtrFn_WakePlatform wakePlatform;
 
         PtrFn_GetPlatformInfo getPlatformInfo;
 
@@ -217,8 +373,17 @@ namespace wfe::editor {
         PtrFn_GetSurface getSurface;
         PtrFn_GetGraphicsQueue getGraphicsQueue;
         PtrFn_GetPresentQueue getPresentQueue;
+        PtrFn_GetTransferQueue getTransferQueue;
+        PtrFn_SubmitToQueue submitToQueue;
+        PtrFn_WaitForQueueIdle waitForQueueIdle;
+        PtrFn_WaitForDeviceIdle waitForDeviceIdle;
+        PtrFn_GetPipelineCache getPipelineCache;
         PtrFn_GetPhysicalDeviceProperties getPhysicalDeviceProperties;
         PtrFn_GetPhysicalDeviceFeatures getPhysicalDeviceFeatures;
+        PtrFn_GetDescriptorIndexingFeatures getDescriptorIndexingFeatures;
+        PtrFn_IsDeviceExtensionEnabled isDeviceExtensionEnabled;
+        PtrFn_IsDynamicRenderingSupported isDynamicRenderingSupported;
+        PtrFn_IsTimelineSemaphoreSupported isTimelineSemaphoreSupported;
         PtrFn_AreValidationLayersEnabled areValidationLayersEnabled;
         PtrFn_EnableValidationLayers enableValidationLayers;
         PtrFn_DisableValidationLayers disableValidationLayers;
@@ -231,8 +396,28 @@ namespace wfe::editor {
 
         PtrFn_CreateBuffer createBuffer;
         PtrFn_CreateImage createImage;
+        PtrFn_CreateBufferAllocation createBufferAllocation;
+        PtrFn_CreateImageAllocation createImageAllocation;
+        PtrFn_BeginCommandBatch beginCommandBatch;
+        PtrFn_SubmitCommandBatch submitCommandBatch;
+        PtrFn_IsCommandBatchComplete isCommandBatchComplete;
+        PtrFn_WaitForCommandBatch waitForCommandBatch;
         PtrFn_BeginSingleTimeCommands beginSingleTimeCommands;
+        PtrFn_UploadImageData uploadImageData;
+        PtrFn_SubmitUploads submitUploads;
+        PtrFn_IsUploadComplete isUploadComplete;
+        PtrFn_WaitForUpload waitForUpload;
+        PtrFn_HasPendingUploads hasPendingUploads;
+        PtrFn_DeferDestroyBuffer deferDestroyBuffer;
+        PtrFn_DeferDestroyImage deferDestroyImage;
+        PtrFn_DeferDestroyImageView deferDestroyImageView;
+        PtrFn_DeferFreeMemory deferFreeMemory;
+        PtrFn_DeferFreeMemoryAllocation deferFreeMemoryAllocation;
+        PtrFn_DeferFreeDescriptorSet deferFreeDescriptorSet;
+        PtrFn_DeferDestroyPipeline deferDestroyPipeline;
+        PtrFn_GetDeferredDeletionCount getDeferredDeletionCount;
         PtrFn_EndSingleTimeCommands endSingleTimeCommands;
+        PtrFn_AllocateFrameCommandBuffer allocateFrameCommandBuffer;
         PtrFn_CopyBuffer copyBuffer;
         PtrFn_CopyImage copyImage;
         PtrFn_CopyBufferToImage copyBufferToImage;
@@ -244,16 +429,69 @@ namespace wfe::editor {
         PtrFn_CreateImGuiPipeline createImGuiPipeline;
         PtrFn_DeleteImGuiPipeline deleteImGuiPipeline;
         PtrFn_DrawImGui drawImGui;
+        PtrFn_HasImGuiFrameChanged hasImGuiFrameChanged;
+        PtrFn_RequestRedraw requestRedraw;
+        PtrFn_IsPresentOnChangeEnabled isPresentOnChangeEnabled;
+        PtrFn_EnablePresentOnChange enablePresentOnChange;
+        PtrFn_DisablePresentOnChange disablePresentOnChange;
+        PtrFn_IsBindlessRenderingEnabled isBindlessRenderingEnabled;
+        PtrFn_EnableBindlessRendering enableBindlessRendering;
+        PtrFn_DisableBindlessRendering disableBindlessRendering;
         
         PtrFn_GetImGuiPipeline getImGuiPipeline;
         PtrFn_GetImGuiPipelineLayout getImGuiPipelineLayout;
         PtrFn_GetImGuiCommandBuffer getImGuiCommandBuffer;
+        PtrFn_GetImGuiPipelineStats getImGuiPipelineStats;
 
         PtrFn_GetImGuiTexture getImGuiTexture;
+        PtrFn_LoadImGuiIcons loadImGuiIcons;
+        PtrFn_RegisterImGuiTexture registerImGuiTexture;
+        PtrFn_LoadImGuiTextures loadImGuiTextures;
+        PtrFn_LoadImGuiTexturesFromMemory loadImGuiTexturesFromMemory;
+        PtrFn_UpdateImGuiTexture updateImGuiTexture;
+        PtrFn_ReleaseImGuiTexture releaseImGuiTexture;
+
+        PtrFn_AreGPUTimingsSupported areGPUTimingsSupported;
+        PtrFn_AreWindowGPUTimingsEnabled areWindowGPUTimingsEnabled;
+        PtrFn_EnableWindowGPUTimings enableWindowGPUTimings;
+        PtrFn_DisableWindowGPUTimings disableWindowGPUTimings;
+
+        PtrFn_BeginGPUScope beginGPUScope;
+        PtrFn_EndGPUScope endGPUScope;
+
+        PtrFn_GetGPUTimings getGPUTimings;
+
+        PtrFn_AllocateMemory allocateMemory;
+        PtrFn_FreeMemory freeMemory;
+        PtrFn_FlushMemory flushMemory;
+
+        PtrFn_GetMemoryAllocatorStats getMemoryAllocatorStats;
+
+        PtrFn_IsHostAllocatorEnabled isHostAllocatorEnabled;
+        PtrFn_GetHostAllocatorStats getHostAllocatorStats;
+        PtrFn_HostAllocationScopeToString hostAllocationScopeToString;
 
         PtrFn_CreateSwapChain createSwapChain;
         PtrFn_DeleteSwapChain deleteSwapChain;
         PtrFn_RecreateSwapChain recreateSwapChain;
+        PtrFn_RequestSwapChainRecreation requestSwapChainRecreation;
+        PtrFn_IsSwapChainRecreationPending isSwapChainRecreationPending;
+        PtrFn_UpdateSwapChain updateSwapChain;
+        PtrFn_GetSwapChainStats getSwapChainStats;
+
+        PtrFn_GetSwapChainAttachmentInfo getSwapChainAttachmentInfo;
+        PtrFn_SetSwapChainAttachmentInfo setSwapChainAttachmentInfo;
+        PtrFn_GetSwapChainAttachmentCount getSwapChainAttachmentCount;
+        PtrFn_IsDynamicRenderingEnabled isDynamicRenderingEnabled;
+        PtrFn_GetPipelineRenderingCreateInfo getPipelineRenderingCreateInfo;
+        PtrFn_BeginSwapChainRendering beginSwapChainRendering;
+        PtrFn_EndSwapChainRendering endSwapChainRendering;
+        PtrFn_IsTimelineSemaphoreEnabled isTimelineSemaphoreEnabled;
+        PtrFn_GetFrameTimelineSemaphore getFrameTimelineSemaphore;
+        PtrFn_GetSubmittedFrameValue getSubmittedFrameValue;
+        PtrFn_GetCompletedFrameValue getCompletedFrameValue;
+        PtrFn_HasGPUReachedFrame hasGPUReachedFrame;
+        PtrFn_WaitForFrame waitForFrame;
 
         PtrFn_GetFrameBuffer getFrameBuffer;
         PtrFn_GetRenderPass getRenderPass;
@@ -264,12 +502,21 @@ namespace wfe::editor {
         PtrFn_GetSwapChainWidth getSwapChainWidth;
         PtrFn_GetSwapChainHeight getSwapChainHeight;
         PtrFn_GetCurrentFrame getCurrentFrame;
+        PtrFn_GetPresentMode getPresentMode;
+        PtrFn_GetPreferredPresentMode getPreferredPresentMode;
+        PtrFn_SetPreferredPresentMode setPreferredPresentMode;
+        PtrFn_GetPreferredImageCount getPreferredImageCount;
+        PtrFn_SetPreferredImageCount setPreferredImageCount;
+        PtrFn_PresentModeToString presentModeToString;
+        PtrFn_StringToPresentMode stringToPresentMode;
 
         PtrFn_ExtentAspectRatio extentAspectRatio;
         PtrFn_FindDepthFormat findDepthFormat;
         
         PtrFn_AcquireNextImage acquireNextImage;
+        PtrFn_QueueFrameCommandBuffer queueFrameCommandBuffer;
         PtrFn_SubmitCommandBuffers submitCommandBuffers;
+        PtrFn_ReadLastFramePixels readLastFramePixels;
 
         PtrFn_LoadEditorProperties loadEditorProperties;
         PtrFn_SaveEditorProperties saveEditorProperties;
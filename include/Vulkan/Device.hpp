@@ -1,11 +1,13 @@
 #pragma once
 
 #include "VulkanInclude.hpp"
+#include "MemoryAllocator.hpp"
 
 namespace wfe::editor {
     struct QueueFamilyIndices {
         uint32_t graphicsFamily; bool8_t graphicsFamilyHasValue;
         uint32_t presentFamily;  bool8_t presentFamilyHasValue;
+        uint32_t transferFamily; bool8_t transferFamilyHasValue;
 
         bool8_t IsComplete() {
             return graphicsFamilyHasValue && presentFamilyHasValue;
@@ -42,10 +44,40 @@ namespace wfe::editor {
     VkQueue GetGraphicsQueue();
     /// @brief Returns the Vulkan present queue.
     VkQueue GetPresentQueue();
+    /// @brief Returns the Vulkan transfer queue. This is the graphics queue if the GPU has no separate transfer queue family.
+    VkQueue GetTransferQueue();
+    /// @brief Submits to the given queue while holding the queue lock. Every submission to the editor's queues must go through this function, since they're shared between threads.
+    /// @param queue The queue to submit to.
+    /// @param submitCount The number of submit infos.
+    /// @param submits A pointer to the submit infos.
+    /// @param fence The fence to signal once the submissions finish, or VK_NULL_HANDLE.
+    /// @return The result of vkQueueSubmit.
+    VkResult SubmitToQueue(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence);
+    /// @brief Presents to the present queue while holding the queue lock. Internal use only.
+    /// @param presentInfo The present info.
+    /// @return The result of vkQueuePresentKHR.
+    VkResult PresentToQueue(const VkPresentInfoKHR& presentInfo);
+    /// @brief Waits for the given queue to idle while holding the queue lock.
+    /// @param queue The queue to wait for.
+    void WaitForQueueIdle(VkQueue queue);
+    /// @brief Waits for the device to idle while holding the queue lock.
+    void WaitForDeviceIdle();
+    /// @brief Returns the Vulkan pipeline cache, which is loaded from disk at startup and saved back at shutdown.
+    VkPipelineCache GetPipelineCache();
     /// @brief Returns the properties of the Vulkan physical device.
     const VkPhysicalDeviceProperties& GetPhysicalDeviceProperties();
     /// @brief Returns the features of the VUlkan physical device.
     const VkPhysicalDeviceFeatures& GetPhysicalDeviceFeatures();
+    /// @brief Returns the enabled Vulkan descriptor indexing features. Every feature is false if the extension isn't supported.
+    const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& GetDescriptorIndexingFeatures();
+    /// @brief Returns true if the GPU supports dynamic rendering through VK_KHR_dynamic_rendering, otherwise false.
+    bool8_t IsDynamicRenderingSupported();
+    /// @brief Returns true if the GPU supports timeline semaphores through VK_KHR_timeline_semaphore, otherwise false.
+    bool8_t IsTimelineSemaphoreSupported();
+    /// @brief Checks if the given device extension is enabled.
+    /// @param extensionName The name of the extension.
+    /// @return True if the extension is enabled, otherwise false.
+    bool8_t IsDeviceExtensionEnabled(const char_t* extensionName);
     /// @brief Returns true if validation layers are enabled, otherwise false.
     bool8_t AreValidationLayersEnabled();
     /// @brief Enables validation layers. Internal use only.
@@ -55,7 +87,7 @@ namespace wfe::editor {
 
     /// @brief Returns details about swap chain support.
     SwapChainSupportDetails GetSwapChainSupport();
-    /// @brief Finds the indices for the graphics and present queue families.
+    /// @brief Finds the indices for the graphics, present and transfer queue families.
     QueueFamilyIndices FindPhysicalQueueFamilies();
 
     /// @brief Finds the memory type of the Vulkan physical device.
@@ -70,24 +102,106 @@ namespace wfe::editor {
     /// @return The first supported format.
     VkFormat FindSupportedFormat(const vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
 
-    /// @brief Creates a Vulkan buffer with the given info.
+    /// @brief Creates a Vulkan buffer with the given info, in its own device memory. Prefer the overload taking a memory allocation.
     /// @param size The buffer's size.
     /// @param usage The buffer usage flags.
     /// @param properties The buffer memory property flags.
     /// @param buffer A reference to the buffer.
     /// @param bufferMemory A reference to the buffer memory.
     void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory);
-    /// @brief Creates a Vulkan image with the given info.
+    /// @brief Creates a Vulkan buffer with the given info, in memory given by the memory allocator.
+    /// @param size The buffer's size.
+    /// @param usage The buffer usage flags.
+    /// @param properties The buffer memory property flags.
+    /// @param buffer A reference to the buffer.
+    /// @param bufferAllocation A reference to the buffer's memory allocation, which must be freed with FreeMemory.
+    void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, MemoryAllocation& bufferAllocation);
+    /// @brief Creates a Vulkan image with the given info, in its own device memory. Prefer the overload taking a memory allocation.
     /// @param imageInfo The image create info.
     /// @param properties The image memory property flags.
     /// @param image A reference to the image.
     /// @param imageMemory A reference to the image memory.
     void CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory);
+    /// @brief Creates a Vulkan image with the given info, in memory given by the memory allocator.
+    /// @param imageInfo The image create info.
+    /// @param properties The image memory property flags.
+    /// @param image A reference to the image.
+    /// @param imageAllocation A reference to the image's memory allocation, which must be freed with FreeMemory.
+    void CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image, MemoryAllocation& imageAllocation);
+    /// @brief Allocates a primary command buffer from the calling thread's command pool for the given frame. Can be called from any thread.
+    /// @param frameIndex The index of the frame the command buffer is submitted with, as returned by GetCurrentFrame on the main thread.
+    /// Worker threads must be given the index by the main thread, and must finish recording and queue the command buffer with QueueFrameCommandBuffer
+    /// before the main thread submits that frame, since the main thread resets the pool once the frame finishes.
+    /// @return The allocated command buffer. It is recycled once its frame finishes.
+    VkCommandBuffer AllocateFrameCommandBuffer(uint32_t frameIndex);
+    /// @brief Resets every thread's command pool for the given frame. Internal use only.
+    /// @param frameIndex The index of the frame that finished.
+    void ResetFrameCommandPools(uint32_t frameIndex);
+    /// @brief Begins recording a command batch on the calling thread.
+    /// @return The batch's command buffer, which must be submitted with SubmitCommandBatch on the same thread.
+    VkCommandBuffer BeginCommandBatch();
+    /// @brief Submits a command batch to the graphics queue, without waiting for it to finish.
+    /// @param commandBuffer The command buffer returned by BeginCommandBatch.
+    /// @return The batch's handle.
+    uint64_t SubmitCommandBatch(VkCommandBuffer commandBuffer);
+    /// @brief Checks if the given command batch is complete.
+    /// @param batch The batch's handle.
+    /// @return True if the GPU finished executing the batch, otherwise false.
+    bool8_t IsCommandBatchComplete(uint64_t batch);
+    /// @brief Waits for the given command batch to complete.
+    /// @param batch The batch's handle.
+    void WaitForCommandBatch(uint64_t batch);
     /// @brief Begins single time commands.
     VkCommandBuffer BeginSingleTimeCommands();
-    /// @brief Ends single time commands.
+    /// @brief Ends single time commands, waiting for them to finish.
     /// @param commandBuffer The single time command buffer.
     void EndSingleTimeCommands(VkCommandBuffer commandBuffer);
+    /// @brief Queues pixel data to be copied to an image on the transfer queue, without waiting for the copy to finish. Never submits to the graphics queue,
+    /// even if it has to wait for staging memory; the image's ownership is acquired by the next call to SubmitUploads or WaitForUpload.
+    /// @param image The image to copy to. Its contents are discarded and it must not be used until the upload is complete.
+    /// @param width The width of the image.
+    /// @param height The height of the image.
+    /// @param data The pixel data, which is copied before the function returns.
+    /// @param size The size of the pixel data, in bytes.
+    /// @return The upload's handle. The image will be in the shader read only layout, owned by the graphics queue, once the upload is complete.
+    uint64_t UploadImageData(VkImage image, uint32_t width, uint32_t height, const void* data, VkDeviceSize size);
+    /// @brief Submits every queued upload and checks which submitted uploads finished. Internal use only.
+    void SubmitUploads();
+    /// @brief Checks if the given upload is complete.
+    /// @param upload The upload's handle.
+    /// @return True if the image can be used by the graphics queue, otherwise false.
+    bool8_t IsUploadComplete(uint64_t upload);
+    /// @brief Waits for the given upload to complete.
+    /// @param upload The upload's handle.
+    void WaitForUpload(uint64_t upload);
+    /// @brief Returns true if any uploads are queued or in flight, otherwise false.
+    bool8_t HasPendingUploads();
+    /// @brief Destroys the given buffer once every frame submitted so far has finished.
+    /// @param buffer The buffer to destroy. Its memory must be freed separately.
+    void DeferDestroyBuffer(VkBuffer buffer);
+    /// @brief Destroys the given image once every frame submitted so far has finished.
+    /// @param image The image to destroy. Its memory must be freed separately.
+    void DeferDestroyImage(VkImage image);
+    /// @brief Destroys the given image view once every frame submitted so far has finished.
+    /// @param imageView The image view to destroy.
+    void DeferDestroyImageView(VkImageView imageView);
+    /// @brief Frees the given device memory once every frame submitted so far has finished.
+    /// @param memory The device memory to free.
+    void DeferFreeMemory(VkDeviceMemory memory);
+    /// @brief Returns the given allocation to the memory allocator once every frame submitted so far has finished.
+    /// @param allocation The allocation to free.
+    void DeferFreeMemory(const MemoryAllocation& allocation);
+    /// @brief Frees the given descriptor set once every frame submitted so far has finished.
+    /// @param descriptorPool The pool the descriptor set was allocated from, which must be created with VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT.
+    /// @param descriptorSet The descriptor set to free.
+    void DeferFreeDescriptorSet(VkDescriptorPool descriptorPool, VkDescriptorSet descriptorSet);
+    /// @brief Destroys the given pipeline once every frame submitted so far has finished.
+    /// @param pipeline The pipeline to destroy.
+    void DeferDestroyPipeline(VkPipeline pipeline);
+    /// @brief Destroys every deferred resource whose frames finished. Called once per main loop iteration and every time a frame is acquired. Internal use only.
+    void DestroyDeferredResources();
+    /// @brief Returns the number of resources waiting to be destroyed.
+    size_t GetDeferredDeletionCount();
     /// @brief Copies a buffer to another buffer.
     /// @param srcBuffer The buffer to copy from.
     /// @param dstBuffer The buffer to copy to.
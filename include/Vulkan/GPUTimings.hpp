@@ -0,0 +1,52 @@
+#pragma once
+
+#include "VulkanInclude.hpp"
+
+namespace wfe::editor {
+    /// @brief The scope index returned when a GPU scope couldn't be started.
+    const uint32_t INVALID_GPU_SCOPE = UINT32_MAX;
+
+    /// @brief Holds the GPU time of a timed scope.
+    struct GPUTiming {
+        /// @brief The name of the scope.
+        string name;
+        /// @brief The time the GPU spent in the scope, in milliseconds.
+        float64_t duration;
+        /// @brief The number of scopes the scope is nested in.
+        uint32_t depth;
+    };
+
+    /// @brief Creates the GPU timestamp query pools. Internal use only.
+    void CreateGPUTimings();
+    /// @brief Deletes the GPU timestamp query pools. Internal use only.
+    void DeleteGPUTimings();
+
+    /// @brief Returns true if the graphics queue supports timestamps, otherwise false.
+    bool8_t AreGPUTimingsSupported();
+    /// @brief Returns true if every ImGui window's draw commands are timed separately, otherwise false.
+    bool8_t AreWindowGPUTimingsEnabled();
+    /// @brief Times every ImGui window's draw commands separately.
+    void EnableWindowGPUTimings();
+    /// @brief Stops timing ImGui windows separately.
+    void DisableWindowGPUTimings();
+
+    /// @brief Reads back the results of the current frame in flight's last use and starts timing the frame. Must be called outside of a render pass. Internal use only.
+    /// @param commandBuffer The frame's command buffer.
+    void BeginGPUTimingFrame(VkCommandBuffer commandBuffer);
+    /// @brief Stops timing the frame. Internal use only.
+    /// @param commandBuffer The frame's command buffer.
+    void EndGPUTimingFrame(VkCommandBuffer commandBuffer);
+
+    /// @brief Starts timing a scope in the current frame's command buffer.
+    /// @param commandBuffer The command buffer to write the scope's start timestamp to.
+    /// @param name The name of the scope.
+    /// @return The scope's index, or INVALID_GPU_SCOPE if timings aren't supported or the frame ran out of queries.
+    uint32_t BeginGPUScope(VkCommandBuffer commandBuffer, const char_t* name);
+    /// @brief Stops timing a scope.
+    /// @param commandBuffer The command buffer to write the scope's end timestamp to.
+    /// @param scope The scope's index, returned by BeginGPUScope.
+    void EndGPUScope(VkCommandBuffer commandBuffer, uint32_t scope);
+
+    /// @brief Returns the GPU timings of the last frame whose results were read back, in the order their scopes started.
+    const vector<GPUTiming>& GetGPUTimings();
+}
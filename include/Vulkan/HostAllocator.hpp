@@ -0,0 +1,52 @@
+#pragma once
+
+#include "VulkanInclude.hpp"
+
+namespace wfe::editor {
+    /// @brief The number of Vulkan system allocation scopes tracked by the host allocator.
+    const size_t HOST_ALLOCATION_SCOPE_COUNT = VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1;
+
+    /// @brief Holds statistics about the host memory allocated by Vulkan in a single allocation scope.
+    struct HostAllocationScopeStats {
+        /// @brief The number of bytes currently allocated.
+        size_t liveSize;
+        /// @brief The highest number of bytes allocated at once.
+        size_t peakSize;
+        /// @brief The number of allocations currently alive.
+        size_t liveCount;
+        /// @brief The total number of allocations made.
+        size_t allocationCount;
+        /// @brief The number of bytes the driver reported allocating internally, for executable memory.
+        size_t internalSize;
+    };
+
+    /// @brief Holds statistics about the host memory allocated by Vulkan.
+    struct HostAllocatorStats {
+        /// @brief The stats of every allocation scope, indexed by VkSystemAllocationScope.
+        HostAllocationScopeStats scopes[HOST_ALLOCATION_SCOPE_COUNT];
+        /// @brief The number of command scope allocations made during the last frame.
+        size_t frameCommandAllocationCount;
+        /// @brief The number of command scope bytes allocated during the last frame.
+        size_t frameCommandAllocationSize;
+        /// @brief The average number of command scope allocations made every frame.
+        float64_t averageFrameCommandAllocationCount;
+        /// @brief The average number of command scope bytes allocated every frame.
+        float64_t averageFrameCommandAllocationSize;
+        /// @brief The number of arena chunks backing the command scope allocations of every thread.
+        size_t arenaChunkCount;
+    };
+
+    /// @brief Returns the allocation callbacks given to every Vulkan function, or nullptr if the host allocator is disabled. Internal use only.
+    const VkAllocationCallbacks* GetHostAllocationCallbacks();
+    /// @brief Returns true if Vulkan's host memory goes through the host allocator, otherwise false.
+    bool8_t IsHostAllocatorEnabled();
+    /// @brief Makes Vulkan use the driver's own host allocator. Must be called before the device is created. Internal use only.
+    void DisableHostAllocator();
+    /// @brief Marks the start of a new frame for the per frame stats. Internal use only.
+    void MarkHostAllocatorFrame();
+
+    /// @brief Returns the host allocator's current statistics.
+    HostAllocatorStats GetHostAllocatorStats();
+    /// @brief Returns the name of the given allocation scope.
+    const char_t* HostAllocationScopeToString(VkSystemAllocationScope scope);
+}
@@ -11,12 +11,72 @@ namespace wfe::editor {
         IMAGE_ID_FOLDER_FULL,
     } ImageID;
 
+    /// @brief Describes a rectangular region of an ImGui texture.
+    struct ImGuiTextureRegion {
+        /// @brief The ImGui ID of the texture that holds the region.
+        ImTextureID textureId;
+        /// @brief The UV coordinates of the region's top left corner.
+        ImVec2 uv0;
+        /// @brief The UV coordinates of the region's bottom right corner.
+        ImVec2 uv1;
+    };
+
+    /// @brief Holds statistics about the ImGui pipeline.
+    struct ImGuiPipelineStats {
+        /// @brief The number of times a vertex or index buffer had to grow.
+        size_t geometryBufferGrowCount;
+        /// @brief The current capacity of every vertex buffer, in bytes.
+        VkDeviceSize vertexBufferCapacity;
+        /// @brief The current capacity of every index buffer, in bytes.
+        VkDeviceSize indexBufferCapacity;
+        /// @brief The current capacity of every bindless texture index buffer, in bytes.
+        VkDeviceSize textureIndexBufferCapacity;
+        /// @brief The number of ImGui draw commands processed last frame.
+        size_t drawCommandCount;
+        /// @brief The number of draw calls recorded last frame.
+        size_t drawCallCount;
+        /// @brief The total number of state changes recorded last frame, including the ones below.
+        size_t stateChangeCount;
+        /// @brief The number of descriptor set binds recorded last frame.
+        size_t descriptorSetBindCount;
+        /// @brief The number of scissor changes recorded last frame.
+        size_t scissorChangeCount;
+        /// @brief The total number of frames that were drawn and presented.
+        size_t presentedFrameCount;
+        /// @brief The total number of frames that were skipped because nothing changed.
+        size_t skippedFrameCount;
+    };
+
+    /// @brief Returns the number of images loaded when the pipeline is created. Internal use only.
+    size_t GetStartupImageCount();
+    /// @brief Decodes one of the images loaded when the pipeline is created, ahead of time. Can run on any thread before the pipeline is created. Internal use only.
+    /// @param index The image's index, less than GetStartupImageCount().
+    void DecodeStartupImage(size_t index);
     /// @brief Creates the ImGui pipeline. Internal use only.
     void CreateImGuiPipeline();
     /// @brief Deletes the ImGui pipeline. Internal use only.
     void DeleteImGuiPipeline();
     /// @brief Draws the ImGui objects. Internal use only.
     void DrawImGui();
+    /// @brief Checks if the current ImGui draw data differs from the last presented frame. Internal use only.
+    /// @return True if the frame needs to be drawn, otherwise false.
+    bool8_t HasImGuiFrameChanged();
+    /// @brief Forces the next frame to be drawn and presented, even if its draw data is unchanged.
+    void RequestRedraw();
+
+    /// @brief Returns true if ImGui textures are drawn from a single bindless texture array, otherwise false.
+    bool8_t IsBindlessRenderingEnabled();
+    /// @brief Draws ImGui textures from a single texture array and merges draw calls, if supported by the GPU. Internal use only.
+    void EnableBindlessRendering();
+    /// @brief Draws every ImGui texture with its own descriptor set. Internal use only.
+    void DisableBindlessRendering();
+
+    /// @brief Returns true if frames are only presented when their contents change, otherwise false.
+    bool8_t IsPresentOnChangeEnabled();
+    /// @brief Only presents frames when their contents change. Internal use only.
+    void EnablePresentOnChange();
+    /// @brief Presents every frame, even if its contents are unchanged. Internal use only.
+    void DisablePresentOnChange();
 
     /// @brief Returns the ImGui pipeline.
     VkPipeline GetImGuiPipeline();
@@ -24,8 +84,41 @@ namespace wfe::editor {
     VkPipelineLayout GetImGuiPipelineLayout();
     /// @brief Returns the ImGui command buffer.
     VkCommandBuffer GetImGuiCommandBuffer();
+    /// @brief Returns the ImGui pipeline's statistics.
+    const ImGuiPipelineStats& GetImGuiPipelineStats();
 
-    /// @brief Returns the coresponding ImGui texture ID for the given image ID.
+    /// @brief Returns the region of the icon atlas that holds the given image.
     /// @param imageId The image ID.
-    ImTextureID GetImGuiTexture(ImageID imageId);
+    ImGuiTextureRegion GetImGuiTexture(ImageID imageId);
+    /// @brief Decodes the given icon files on the worker threads and packs them into shared atlas textures.
+    /// @param count The number of icons.
+    /// @param filenames The icons' filenames.
+    /// @param regions The array to write the icons' atlas regions to. The texture ID of every icon that failed to decode is set to nullptr.
+    void LoadImGuiIcons(size_t count, const char_t* const* filenames, ImGuiTextureRegion* regions);
+    /// @brief Creates a texture that can be drawn with ImGui. Its pixel data is uploaded in the background and it isn't drawn until the upload is complete.
+    /// @param width The width of the texture, in pixels.
+    /// @param height The height of the texture, in pixels.
+    /// @param data The texture's RGBA8 pixel data.
+    /// @return The texture's ImGui ID, which stays valid until the texture is released.
+    ImTextureID RegisterImGuiTexture(size_t width, size_t height, const void* data);
+    /// @brief Decodes the given image files on the worker threads and registers them as ImGui textures.
+    /// @param count The number of images.
+    /// @param filenames The images' filenames.
+    /// @param textureIds The array to write the textures' ImGui IDs to. The ID of every image that failed to decode is set to nullptr.
+    void LoadImGuiTextures(size_t count, const char_t* const* filenames, ImTextureID* textureIds);
+    /// @brief Decodes the given encoded images on the worker threads and registers them as ImGui textures.
+    /// @param count The number of images.
+    /// @param encodedData The images' encoded data, in any format supported by stb_image.
+    /// @param encodedSizes The sizes of the images' encoded data, in bytes.
+    /// @param textureIds The array to write the textures' ImGui IDs to. The ID of every image that failed to decode is set to nullptr.
+    void LoadImGuiTexturesFromMemory(size_t count, const void* const* encodedData, const size_t* encodedSizes, ImTextureID* textureIds);
+    /// @brief Replaces the contents of a registered ImGui texture once the new contents are uploaded. The texture's ID doesn't change, even if its size does.
+    /// @param textureId The texture's ImGui ID.
+    /// @param width The new width of the texture, in pixels.
+    /// @param height The new height of the texture, in pixels.
+    /// @param data The texture's new RGBA8 pixel data.
+    void UpdateImGuiTexture(ImTextureID textureId, size_t width, size_t height, const void* data);
+    /// @brief Releases a registered ImGui texture. Its resources are destroyed once every frame that might use it finishes.
+    /// @param textureId The texture's ImGui ID.
+    void ReleaseImGuiTexture(ImTextureID textureId);
 }
\ No newline at end of file
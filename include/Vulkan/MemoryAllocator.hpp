@@ -0,0 +1,73 @@
+#pragma once
+
+#include "VulkanInclude.hpp"
+
+namespace wfe::editor {
+    /// @brief A large block of device memory that allocations are carved out of. Internal use only.
+    struct MemoryBlock;
+
+    /// @brief Holds info about a range of device memory given by the memory allocator.
+    struct MemoryAllocation {
+        /// @brief The device memory the allocation lives in, shared with other allocations unless the allocation is dedicated.
+        VkDeviceMemory memory;
+        /// @brief The offset of the allocation in its device memory.
+        VkDeviceSize offset;
+        /// @brief The size of the allocation, at least as large as the requested size.
+        VkDeviceSize size;
+        /// @brief A pointer to the allocation's mapped memory if its memory is host visible, otherwise nullptr. Stays valid until the allocation is freed.
+        void* mappedMemory;
+        /// @brief The index of the allocation's memory type.
+        uint32_t memoryTypeIndex;
+        /// @brief The block the allocation was carved out of, or nullptr if the allocation is dedicated. Internal use only.
+        MemoryBlock* block;
+        /// @brief The order of the allocation's range in its block. Internal use only.
+        uint32_t order;
+    };
+
+    /// @brief Holds statistics about the memory allocator.
+    struct MemoryAllocatorStats {
+        /// @brief The number of live device memory allocations, including blocks and dedicated allocations.
+        size_t deviceAllocationCount;
+        /// @brief The maximum number of device memory allocations supported by the driver.
+        size_t maxDeviceAllocationCount;
+        /// @brief The number of memory blocks.
+        size_t blockCount;
+        /// @brief The number of allocations carved out of memory blocks.
+        size_t blockAllocationCount;
+        /// @brief The number of allocations with their own device memory.
+        size_t dedicatedAllocationCount;
+        /// @brief The total size of every memory block, in bytes.
+        VkDeviceSize blockSize;
+        /// @brief The total size of every allocation carved out of memory blocks, in bytes.
+        VkDeviceSize usedBlockSize;
+        /// @brief The total size of every dedicated allocation, in bytes.
+        VkDeviceSize dedicatedSize;
+        /// @brief The size of the largest free range in any memory block, in bytes.
+        VkDeviceSize largestFreeRange;
+        /// @brief The fraction of free block memory outside of the largest free range of its block, from 0 to 1.
+        float32_t fragmentation;
+    };
+
+    /// @brief Creates the memory allocator. Internal use only.
+    void CreateMemoryAllocator();
+    /// @brief Frees every memory block. Every allocation must be freed beforehand. Internal use only.
+    void DeleteMemoryAllocator();
+
+    /// @brief Allocates device memory for a resource, carving it out of a memory block unless it's too large.
+    /// @param memoryRequirements The resource's memory requirements.
+    /// @param properties The memory property flags.
+    /// @param linear True if the resource is a buffer or a linear image, false if it's an optimal image.
+    /// @param allocation A reference to the allocation.
+    void AllocateMemory(const VkMemoryRequirements& memoryRequirements, VkMemoryPropertyFlags properties, bool8_t linear, MemoryAllocation& allocation);
+    /// @brief Frees the given allocation. Does nothing if the allocation has no memory, like a zeroed allocation.
+    /// @param allocation A reference to the allocation.
+    void FreeMemory(MemoryAllocation& allocation);
+    /// @brief Flushes a range of a host visible allocation, so its writes become visible to the device.
+    /// @param allocation The allocation to flush.
+    /// @param offset The offset of the range, relative to the allocation.
+    /// @param size The size of the range, or VK_WHOLE_SIZE to flush the rest of the allocation.
+    void FlushMemory(const MemoryAllocation& allocation, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+    /// @brief Returns the memory allocator's current statistics.
+    MemoryAllocatorStats GetMemoryAllocatorStats();
+}
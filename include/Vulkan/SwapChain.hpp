@@ -5,16 +5,86 @@
 namespace wfe::editor {
     const size_t MAX_FRAMES_IN_FLIGHT = 2;
 
+    /// @brief Describes the attachments of the swap chain's render pass, besides the color attachment.
+    struct SwapChainAttachmentInfo {
+        /// @brief Whether every swap chain image gets a full screen depth attachment. Disabled by default, since the editor's UI doesn't use depth.
+        bool8_t depthAttachment;
+    };
+
+    /// @brief Holds statistics about the swap chain's recreations.
+    struct SwapChainStats {
+        /// @brief The total number of times the swap chain was recreated.
+        size_t recreateCount;
+        /// @brief The number of recreations forced by the swap chain going out of date.
+        size_t outOfDateRecreateCount;
+        /// @brief The number of recreation requests merged into an already pending recreation.
+        size_t coalescedRequestCount;
+        /// @brief The time the last recreation took, in milliseconds.
+        float64_t lastRecreateTime;
+        /// @brief The total time spent recreating the swap chain, in milliseconds.
+        float64_t totalRecreateTime;
+    };
+
     /// @brief Creates the Vulkan swap chain. Internal use only.
     void CreateSwapChain();
     /// @brief Deletes the Vulkan swap chain. Internal use only.
     void DeleteSwapChain();
-    /// @brief Recreates the Vulkan swap chain, called when the window is resized. Internal use only.
+    /// @brief Recreates the Vulkan swap chain immediately. Prefer RequestSwapChainRecreation. Internal use only.
     void RecreateSwapChain();
+    /// @brief Requests a swap chain recreation, called when the window is resized. Bursts of requests are merged into a single recreation.
+    void RequestSwapChainRecreation();
+    /// @brief Returns true if a requested swap chain recreation wasn't applied yet, otherwise false.
+    bool8_t IsSwapChainRecreationPending();
+    /// @brief Applies the pending swap chain recreation, if its requests settled. Internal use only.
+    /// @return True if the swap chain was recreated, otherwise false.
+    bool8_t UpdateSwapChain();
+    /// @brief Returns the swap chain's recreation statistics.
+    const SwapChainStats& GetSwapChainStats();
+
+    /// @brief Returns the attachments of the swap chain's render pass.
+    const SwapChainAttachmentInfo& GetSwapChainAttachmentInfo();
+    /// @brief Sets the attachments of the swap chain's render pass. Must be called before the swap chain is created. Internal use only.
+    /// @param attachmentInfo The new attachment info.
+    void SetSwapChainAttachmentInfo(const SwapChainAttachmentInfo& attachmentInfo);
+    /// @brief Returns the number of attachments in the swap chain's render pass, including the color attachment.
+    uint32_t GetSwapChainAttachmentCount();
 
-    /// @brief Returns the framebuffer at the specified index.
+    /// @brief Returns true if the swap chain is rendered to with dynamic rendering instead of a render pass, otherwise false.
+    bool8_t IsDynamicRenderingEnabled();
+    /// @brief Makes the swap chain use a render pass even if dynamic rendering is supported. Must be called before the swap chain is created. Internal use only.
+    void DisableDynamicRendering();
+    /// @brief Returns the rendering info pipelines that draw to the swap chain must be created with when dynamic rendering is enabled.
+    const VkPipelineRenderingCreateInfoKHR* GetPipelineRenderingCreateInfo();
+    /// @brief Begins rendering to the swap chain image at the specified index, with either dynamic rendering or the render pass.
+    /// @param commandBuffer The command buffer to record to.
+    /// @param imageIndex The index of the swap chain image to render to.
+    /// @param clearValues A pointer to the clear values of every attachment, GetSwapChainAttachmentCount() values long.
+    void BeginSwapChainRendering(VkCommandBuffer commandBuffer, uint32_t imageIndex, const VkClearValue* clearValues);
+    /// @brief Ends rendering to the swap chain image at the specified index and prepares it to be presented.
+    /// @param commandBuffer The command buffer to record to.
+    /// @param imageIndex The index of the swap chain image rendered to.
+    void EndSwapChainRendering(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+
+    /// @brief Returns true if frames are synchronized with a timeline semaphore instead of fences, otherwise false.
+    bool8_t IsTimelineSemaphoreEnabled();
+    /// @brief Makes the swap chain synchronize frames with fences even if timeline semaphores are supported. Must be called before the swap chain is created. Internal use only.
+    void DisableTimelineSemaphore();
+    /// @brief Returns the timeline semaphore signaled with every frame's value once the frame finishes, or VK_NULL_HANDLE if it's disabled.
+    VkSemaphore GetFrameTimelineSemaphore();
+    /// @brief Returns the value of the last submitted frame. Frame values start at 1 and increase by 1 with every submitted frame.
+    uint64_t GetSubmittedFrameValue();
+    /// @brief Returns the value of the last frame the GPU finished.
+    uint64_t GetCompletedFrameValue();
+    /// @brief Returns true if the GPU finished the frame with the given value, otherwise false.
+    /// @param value The frame's value.
+    bool8_t HasGPUReachedFrame(uint64_t value);
+    /// @brief Waits for the GPU to finish the frame with the given value.
+    /// @param value The frame's value, which must have already been submitted.
+    void WaitForFrame(uint64_t value);
+
+    /// @brief Returns the framebuffer at the specified index, or VK_NULL_HANDLE if dynamic rendering is enabled.
     VkFramebuffer GetFrameBuffer(size_t index);
-    /// @brief Returns the render pass
+    /// @brief Returns the render pass, or VK_NULL_HANDLE if dynamic rendering is enabled.
     VkRenderPass GetRenderPass();
     /// @brief Returns the image view at the specified index.
     VkImageView GetImageView(size_t index);
@@ -31,6 +101,26 @@ namespace wfe::editor {
     /// @brief Returns the current frame index % MAX_FRAMES_IN_FLIGHT.
     uint32_t GetCurrentFrame();
 
+    /// @brief Returns the present mode the swap chain was created with.
+    VkPresentModeKHR GetPresentMode();
+    /// @brief Returns the requested present mode.
+    VkPresentModeKHR GetPreferredPresentMode();
+    /// @brief Sets the requested present mode and recreates the swap chain. FIFO is used instead if the surface doesn't support it.
+    /// @param presentMode The requested present mode. Must be FIFO, FIFO relaxed, mailbox or immediate.
+    void SetPreferredPresentMode(VkPresentModeKHR presentMode);
+    /// @brief Returns the requested number of swap chain images, or 0 if the surface's minimum image count plus one is used.
+    uint32_t GetPreferredImageCount();
+    /// @brief Sets the requested number of swap chain images and recreates the swap chain. The count is clamped to the surface's limits.
+    /// @param imageCount The requested number of images, or 0 to use the surface's minimum image count plus one.
+    void SetPreferredImageCount(uint32_t imageCount);
+    /// @brief Returns the name of the given present mode, as used by the editor properties and the --presentmode arg.
+    const char_t* PresentModeToString(VkPresentModeKHR presentMode);
+    /// @brief Finds the present mode with the given name.
+    /// @param name The name of the present mode.
+    /// @param presentMode The present mode with the given name.
+    /// @return True if a present mode with the given name exists, otherwise false.
+    bool8_t StringToPresentMode(const char_t* name, VkPresentModeKHR& presentMode);
+
     /// @brief Returns the aspect ratio of the swap chain's extent.
     float32_t ExtentAspectRatio();
     /// @brief Returns the swap chain depth format.
@@ -38,6 +128,13 @@ namespace wfe::editor {
 
     /// @brief Acquires the next image in the swap chain.
     VkResult AcquireNextImage(uint32_t* imageIndex);
-    /// @brief Submits the specified command buffer(s).
+    /// @brief Queues a command buffer recorded on any thread to be submitted with the next frame, before the frame's own command buffers.
+    /// @param commandBuffer The command buffer, allocated with AllocateFrameCommandBuffer for the current frame and fully recorded.
+    void QueueFrameCommandBuffer(VkCommandBuffer commandBuffer);
+    /// @brief Submits the specified command buffer(s), after every queued frame command buffer.
     VkResult SubmitCommandBuffers(const VkCommandBuffer* buffers, uint32_t* imageIndex, uint32_t bufferCount = 1);
+    /// @brief Copies the contents of the last submitted frame, waiting for it to finish. Only supported in headless mode.
+    /// @param pixels A pointer to the memory to write the frame's RGBA8 pixels to, at least width * height * 4 bytes long.
+    /// @return True if the frame was read, otherwise false.
+    bool8_t ReadLastFramePixels(void* pixels);
 }
\ No newline at end of file
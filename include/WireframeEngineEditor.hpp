@@ -4,9 +4,15 @@
 #include "EditorPlatform/Platform.hpp"
 #include "General/Application.hpp"
 #include "General/ImGui.hpp"
+#include "General/ThreadPool.hpp"
+#include "General/ImageWriter.hpp"
+#include "General/Profiler.hpp"
 #include "Linking/FunctionPtrs.hpp"
 #include "Vulkan/Device.hpp"
 #include "Vulkan/SwapChain.hpp"
 #include "Vulkan/ImGuiPipeline.hpp"
+#include "Vulkan/GPUTimings.hpp"
+#include "Vulkan/MemoryAllocator.hpp"
+#include "Vulkan/HostAllocator.hpp"
 #include "Windows/EditorPropertiesWindow.hpp"
 #include "Windows/NewProjectWindow.hpp"
\ No newline at end of file
@@ -1,10 +1,12 @@
 #include "Base/Window.hpp"
 #include "General/Application.hpp"
+#include "General/Profiler.hpp"
 #include "EditorPlatform/Platform.hpp"
 #include "Windows/EditorPropertiesWindow.hpp"
 #include "Windows/NewProjectWindow.hpp"
 #include "Linking/FunctionPtrs.hpp"
 #include <dlfcn.h>
+#include <chrono>
 
 namespace wfe::editor {
     // Variables
@@ -20,7 +22,12 @@ namespace wfe::editor {
     vector<string> recentDirs;
     void* workspaceDynamicLib;
 
+    float64_t nextWindowRefreshTime = -1.0;
+
     // Internal helper functions
+    static float64_t GetWindowRefreshClock() {
+        return std::chrono::duration<float64_t>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
     static void LoadEditorInfo() {
         // Load the ImGui ini settings
         ImGui::LoadIniSettingsFromDisk((workspaceDir + "imgui.ini").c_str());
@@ -236,10 +243,14 @@ namespace wfe::editor {
             ImGui::EndMenuBar();
         }
 
-        // Render every window
+        // Render every window; the windows schedule their next refreshes while rendering
+        nextWindowRefreshTime = -1.0;
+
         for(auto& windowType : *WindowType::windowTypes)
-            if(windowType.val2.open)
+            if(windowType.val2.open) {
+                WFE_PROFILE_ZONE_DYNAMIC(windowType.val2.name.c_str());
                 windowType.val2.render();
+            }
 
         ImGui::PopStyleVar(2);
 
@@ -355,4 +366,28 @@ namespace wfe::editor {
             SetMainWindowName("Wireframe Engine");
         }
     }
-}
\ No newline at end of file
+
+    bool8_t ShouldRefreshWindow(WindowRefreshTimer& timer, float64_t interval) {
+        float64_t currentTime = GetWindowRefreshClock();
+
+        // Refresh the window if its interval elapsed
+        bool8_t refresh = currentTime - timer.lastRefreshTime >= interval;
+        if(refresh)
+            timer.lastRefreshTime = currentTime;
+        
+        // Wake up the main loop for the window's next refresh
+        float64_t refreshTime = timer.lastRefreshTime + interval;
+        if(nextWindowRefreshTime < 0.0 || refreshTime < nextWindowRefreshTime)
+            nextWindowRefreshTime = refreshTime;
+
+        return refresh;
+    }
+    float64_t GetWindowRefreshTimeout() {
+        // Exit the function if no window has to be refreshed
+        if(nextWindowRefreshTime < 0.0)
+            return -1.0;
+        
+        float64_t timeout = nextWindowRefreshTime - GetWindowRefreshClock();
+        return timeout > 0.0 ? timeout : 0.0;
+    }
+}
@@ -8,6 +8,9 @@
 #include "ProjectInfo.hpp"
 #include "imgui.hpp"
 #include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
 #include <X11/Xlib.h>
 #include <X11/XKBlib.h>
 #include <X11/keysym.h>
@@ -17,6 +20,10 @@ const wfe::size_t SCROLL_WHEEL_DELTA = .5f;
 
 // Variables
 wfe::editor::PlatformInfo editorPlatformInfo;
+int wakeEventFd = -1;
+
+int lastWindowX = 0, lastWindowY = 0;                                                                                   // The last reported position of the main window
+unsigned int lastWindowWidth = wfe::editor::DEFAULT_WINDOW_WIDTH, lastWindowHeight = wfe::editor::DEFAULT_WINDOW_HEIGHT; // The last reported size of the main window
 
 // Internal helper functions
 // Converts the Xkb KeySym to an ImGui key code
@@ -464,29 +471,40 @@ static void ProcessEvent(const XEvent& event) {
     }
     case ConfigureNotify:
     {
-        // Create the window move event
-        wfe::editor::WindowMoveEventInfo* windowMoveEventInfo = new wfe::editor::WindowMoveEventInfo();
-        windowMoveEventInfo->windowX = event.xconfigure.x;
-        windowMoveEventInfo->windowY = event.xconfigure.y;
-
-        wfe::editor::Event windowMoveEvent;
-        windowMoveEvent.eventType = wfe::editor::EVENT_TYPE_WINDOW_MOVE;
-        windowMoveEvent.eventInfo = windowMoveEventInfo;
+        // ConfigureNotify is sent for moves, resizes and restacks alike, so only report what actually changed
+        if(event.xconfigure.x != lastWindowX || event.xconfigure.y != lastWindowY) {
+            lastWindowX = event.xconfigure.x;
+            lastWindowY = event.xconfigure.y;
+
+            // Create the window move event
+            wfe::editor::WindowMoveEventInfo* windowMoveEventInfo = new wfe::editor::WindowMoveEventInfo();
+            windowMoveEventInfo->windowX = event.xconfigure.x;
+            windowMoveEventInfo->windowY = event.xconfigure.y;
+
+            wfe::editor::Event windowMoveEvent;
+            windowMoveEvent.eventType = wfe::editor::EVENT_TYPE_WINDOW_MOVE;
+            windowMoveEvent.eventInfo = windowMoveEventInfo;
+
+            // Add the window move event to the queue
+            wfe::editor::AddEvent(windowMoveEvent);
+        }
 
-        // Add the window move event to the queue
-        wfe::editor::AddEvent(windowMoveEvent);
+        if((unsigned int)event.xconfigure.width != lastWindowWidth || (unsigned int)event.xconfigure.height != lastWindowHeight) {
+            lastWindowWidth = event.xconfigure.width;
+            lastWindowHeight = event.xconfigure.height;
 
-        // Create the window resize event
-        wfe::editor::WindowResizeEventInfo* windowResizeEventInfo = new wfe::editor::WindowResizeEventInfo();
-        windowResizeEventInfo->windowWidth = event.xconfigure.width;
-        windowResizeEventInfo->windowHeight = event.xconfigure.height;
+            // Create the window resize event
+            wfe::editor::WindowResizeEventInfo* windowResizeEventInfo = new wfe::editor::WindowResizeEventInfo();
+            windowResizeEventInfo->windowWidth = event.xconfigure.width;
+            windowResizeEventInfo->windowHeight = event.xconfigure.height;
 
-        wfe::editor::Event windowResizeEvent;
-        windowResizeEvent.eventType = wfe::editor::EVENT_TYPE_WINDOW_RESIZE;
-        windowResizeEvent.eventInfo = windowResizeEventInfo;
+            wfe::editor::Event windowResizeEvent;
+            windowResizeEvent.eventType = wfe::editor::EVENT_TYPE_WINDOW_RESIZE;
+            windowResizeEvent.eventInfo = windowResizeEventInfo;
 
-        // Add the window move event to the queue
-        wfe::editor::AddEvent(windowResizeEvent);
+            // Add the window resize event to the queue
+            wfe::editor::AddEvent(windowResizeEvent);
+        }
 
         break;
     }
@@ -503,9 +521,16 @@ static void ProcessEvent(const XEvent& event) {
 void wfe::editor::CreatePlatform() {
     ConnectToX();
     CreateWindow();
+
+    // Create the event fd used to wake up the main loop
+    wakeEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if(wakeEventFd == -1)
+        wfe::console::OutFatalError("Failed to create wake event fd!", 1);
 }
 void wfe::editor::DeletePlatform() {
-    // Nothing required to delete the platform
+    // Close the wake event fd
+    close(wakeEventFd);
+    wakeEventFd = -1;
 }
 void wfe::editor::PollPlatformEvents() {
     // Process every pending event from X
@@ -530,6 +555,43 @@ void wfe::editor::PollPlatformEvents() {
     }
 }
 
+void wfe::editor::WaitPlatformEvents(wfe::float64_t timeout) {
+    // Send every buffered request to X, since the reply might be what we are waiting for
+    XFlush(editorPlatformInfo.display);
+
+    // Exit early if any events were already read from the connection
+    if(XEventsQueued(editorPlatformInfo.display, QueuedAlready))
+        return;
+    
+    // Wait for either the X connection or the wake event fd to become readable
+    pollfd fds[2];
+
+    fds[0].fd = ConnectionNumber(editorPlatformInfo.display);
+    fds[0].events = POLLIN;
+    fds[0].revents = 0;
+
+    fds[1].fd = wakeEventFd;
+    fds[1].events = POLLIN;
+    fds[1].revents = 0;
+
+    int timeoutMilliseconds = timeout < 0.0 ? -1 : (int)(timeout * 1000.0 + .5);
+    poll(fds, 2, timeoutMilliseconds);
+
+    // Reset the wake event fd's counter
+    if(fds[1].revents & POLLIN) {
+        eventfd_t value;
+        eventfd_read(wakeEventFd, &value);
+    }
+}
+void wfe::editor::WakePlatform() {
+    // Exit the function if the platform wasn't created
+    if(wakeEventFd == -1)
+        return;
+
+    // Increment the wake event fd's counter, which wakes up any waiting poll
+    eventfd_write(wakeEventFd, 1);
+}
+
 wfe::editor::PlatformInfo* wfe::editor::GetPlatformInfo() {
     return &editorPlatformInfo;
 }
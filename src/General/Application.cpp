@@ -1,14 +1,58 @@
 #include "General/Application.hpp"
 #include "EditorPlatform/Platform.hpp"
+#include "General/ThreadPool.hpp"
+#include "General/ImageWriter.hpp"
+#include "General/Profiler.hpp"
+#include "Vulkan/GPUTimings.hpp"
+#include "Vulkan/HostAllocator.hpp"
 #include "ProjectInfo.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <stdlib.h>
+
 namespace wfe::editor {
+    struct StartupArgs {
+        const char_t* presentMode;
+        const char_t* imageCount;
+        const char_t* frameRate;
+    };
+    struct StartupPhase {
+        const char_t* name;
+        float64_t time;
+    };
+
+    // Constants
+    const float64_t PENDING_WORK_POLL_INTERVAL = 0.002; // The interval at which pending uploads, swap chain recreations and deferred deletions are checked while idle, in seconds
+    const size_t DEFAULT_HEADLESS_FRAME_COUNT = 300; // The number of frames rendered in headless mode if none were given
+    const float64_t FRAME_LIMITER_SPIN_TIME = 0.002; // The time before a frame's deadline spent spinning instead of sleeping, since sleeps can overshoot, in seconds
+    const size_t STARTUP_TASK_COUNT = 2; // The number of startup tasks run alongside the startup image decodes
+
     // Variables
     vector<Event> eventQueue[EVENT_TYPE_COUNT]; // Stores every event
     vector<Event> temporaryEventQueue;          // Stores every event sent by the user program
 
     bool8_t running = true;           // Whether the program is running
     bool8_t renderingWindows = false; // Whether the windows are currently rendering
+    bool8_t continuousUpdates = false; // Whether a window requested continuous updates this frame
+
+    uint32_t targetFrameRate = 0;                                // The frame rate the main loop is limited to, or 0 if uncapped
+    std::chrono::steady_clock::time_point nextFrameDeadline = {}; // The time the frame limiter lets the next frame start at
+
+    bool8_t headless = false;                                 // Whether the editor renders offscreen, without a window
+    size_t headlessFrameCount = DEFAULT_HEADLESS_FRAME_COUNT; // The number of frames to render before exiting in headless mode
+    string frameDumpDir = "";                                 // The directory every headless frame is written to, if any
+    vector<float64_t> frameTimes;                             // The time every headless frame took, in milliseconds
+
+    string traceFilename = ""; // The file the profiler's trace is exported to on exit, if any
+
+    bool8_t startupProfile = false;                      // Whether the time of every startup phase is output
+    vector<StartupPhase> startupPhases;                  // The time every startup phase took, in milliseconds
+    std::mutex startupPhaseMutex;                        // Guards the startup phases, which are recorded by every startup task
+    std::atomic<uint64_t> startupImageDecodeTime{ 0 };   // The time spent decoding startup images on every thread, in microseconds
 
     size_t mainWindowWidth = DEFAULT_WINDOW_WIDTH;   // The width of the main window
     size_t mainWindowHeight = DEFAULT_WINDOW_HEIGHT; // The height of the main window
@@ -41,10 +85,13 @@ namespace wfe::editor {
             auto& lastResizeEvent = eventQueue[EVENT_TYPE_WINDOW_RESIZE].back();
             WindowResizeEventInfo* resizeEventInfo = (WindowResizeEventInfo*)lastResizeEvent.eventInfo;
 
-            mainWindowWidth = resizeEventInfo->windowWidth;
-            mainWindowHeight = resizeEventInfo->windowHeight;
+            // Request a swap chain recreation only if the size actually changed; the requests are merged while the window is being resized
+            if(resizeEventInfo->windowWidth != mainWindowWidth || resizeEventInfo->windowHeight != mainWindowHeight) {
+                mainWindowWidth = resizeEventInfo->windowWidth;
+                mainWindowHeight = resizeEventInfo->windowHeight;
 
-            RecreateSwapChain();
+                RequestSwapChainRecreation();
+            }
         }
 
         // Check if there are any rename events
@@ -76,61 +123,341 @@ namespace wfe::editor {
         temporaryEventQueue.clear();
     }
 
+    // Checks if any events are waiting to be processed
+    static bool8_t HasQueuedEvents() {
+        for(size_t i = 0; i < EVENT_TYPE_COUNT; ++i)
+            if(eventQueue[i].size())
+                return true;
+        
+        return false;
+    }
+
+    // Waits until the next frame is allowed to start, if the frame rate is limited
+    static void LimitFrameRate() {
+        if(!targetFrameRate)
+            return;
+        
+        WFE_PROFILE_ZONE("LimitFrameRate");
+
+        auto framePeriod = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float64_t>(1.0 / targetFrameRate));
+        auto spinTime = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float64_t>(FRAME_LIMITER_SPIN_TIME));
+        auto currentTime = std::chrono::steady_clock::now();
+
+        // Schedule the next frame one period after the last one, so the frame rate doesn't drift. Start a new schedule if the frame ran late
+        nextFrameDeadline += framePeriod;
+        if(nextFrameDeadline <= currentTime) {
+            nextFrameDeadline = currentTime;
+            return;
+        }
+
+        // Sleep for most of the remaining time, then spin until the deadline
+        if(nextFrameDeadline - currentTime > spinTime)
+            std::this_thread::sleep_until(nextFrameDeadline - spinTime);
+        
+        while(std::chrono::steady_clock::now() < nextFrameDeadline)
+            std::this_thread::yield();
+    }
+
+    // Records the time since the given start time as a startup phase and returns the current time, so the next phase can start from it
+    static std::chrono::steady_clock::time_point RecordStartupPhase(const char_t* name, std::chrono::steady_clock::time_point startTime) {
+        auto endTime = std::chrono::steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(startupPhaseMutex);
+        startupPhases.push_back({ name, std::chrono::duration<float64_t, std::milli>(endTime - startTime).count() });
+
+        return endTime;
+    }
+    // Creates the window, the device and the swap chain, which depend on each other and have to be created in order
+    static void CreateDisplaySubsystems(const StartupArgs& startupArgs) {
+        auto phaseStartTime = std::chrono::steady_clock::now();
+
+        if(!headless) {
+            CreatePlatform();
+            phaseStartTime = RecordStartupPhase("Platform", phaseStartTime);
+        }
+
+        // The display settings given as console args override the ones in the editor properties, so they're applied after loading them
+        LoadEditorProperties();
+        if(startupArgs.presentMode) {
+            VkPresentModeKHR presentMode;
+            if(StringToPresentMode(startupArgs.presentMode, presentMode))
+                SetPreferredPresentMode(presentMode);
+            else
+                console::OutWarningFunction((string)"Unknown present mode " + startupArgs.presentMode + "! Expected fifo, fiforelaxed, mailbox or immediate.");
+        }
+        if(startupArgs.imageCount)
+            SetPreferredImageCount((uint32_t)strtoul(startupArgs.imageCount, nullptr, 10));
+        if(startupArgs.frameRate)
+            SetTargetFrameRate((uint32_t)strtoul(startupArgs.frameRate, nullptr, 10));
+        phaseStartTime = RecordStartupPhase("Editor properties", phaseStartTime);
+
+        CreateDevice();
+        phaseStartTime = RecordStartupPhase("Device", phaseStartTime);
+        CreateGPUTimings();
+        phaseStartTime = RecordStartupPhase("GPU timings", phaseStartTime);
+        CreateSwapChain();
+        RecordStartupPhase("Swap chain", phaseStartTime);
+    }
+    // Runs one of the startup tasks; the display subsystems and the fonts come first, followed by every startup image
+    static void RunStartupTask(size_t index, void* userData) {
+        auto startTime = std::chrono::steady_clock::now();
+
+        switch(index) {
+        case 0: {
+            WFE_PROFILE_ZONE("CreateDisplaySubsystems");
+            CreateDisplaySubsystems(*(const StartupArgs*)userData);
+            break;
+        }
+        case 1: {
+            WFE_PROFILE_ZONE("BakeImGuiFonts");
+            BakeImGuiFonts();
+            RecordStartupPhase("Fonts", startTime);
+            break;
+        }
+        default: {
+            WFE_PROFILE_ZONE("DecodeStartupImage");
+            DecodeStartupImage(index - STARTUP_TASK_COUNT);
+            startupImageDecodeTime += (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+            break;
+        }
+        }
+    }
+    // Outputs the time every startup phase took
+    static void OutputStartupProfile(float64_t totalTime) {
+        console::OutMessageFunction("Startup profile (ms):");
+        for(const auto& phase : startupPhases)
+            console::OutMessageFunction((string)"  " + phase.name + ": " + ToString(phase.time));
+        console::OutMessageFunction((string)"  Image decoding, summed over every thread: " + ToString(startupImageDecodeTime / 1000.0));
+        console::OutMessageFunction((string)"  Total: " + ToString(totalTime));
+    }
+
+    // Writes the last rendered frame to the frame dump directory
+    static void DumpFrame(size_t frameIndex) {
+        size_t width = GetSwapChainWidth(), height = GetSwapChainHeight();
+        vector<uint8_t> pixels(width * height * 4);
+
+        if(!ReadLastFramePixels(pixels.data()))
+            return;
+        
+        string filename = frameDumpDir + "/frame" + ToString(frameIndex) + ".png";
+        if(!WritePNGFile(filename, width, height, pixels.data()))
+            console::OutWarningFunction((string)"Failed to write frame dump " + filename + "!");
+    }
+    // Outputs the frame time statistics of a headless run
+    static void OutputFrameTimes() {
+        if(frameTimes.empty())
+            return;
+        
+        // Sort the frame times to find the percentiles
+        std::sort(frameTimes.data(), frameTimes.data() + frameTimes.size());
+
+        float64_t totalTime = 0.0;
+        for(float64_t frameTime : frameTimes)
+            totalTime += frameTime;
+        
+        float64_t averageTime = totalTime / frameTimes.size();
+        float64_t medianTime = frameTimes[frameTimes.size() / 2];
+        float64_t p95Time = frameTimes[(frameTimes.size() * 95) / 100 < frameTimes.size() ? (frameTimes.size() * 95) / 100 : frameTimes.size() - 1];
+
+        console::OutMessageFunction((string)"Rendered " + ToString(frameTimes.size()) + " headless frames at " + ToString(GetSwapChainWidth()) + "x" + ToString(GetSwapChainHeight()) + ".");
+        console::OutMessageFunction((string)"Frame times (ms): average " + ToString(averageTime) + ", median " + ToString(medianTime) + ", 95th percentile " + ToString(p95Time) + ", min " + ToString(frameTimes[0]) + ", max " + ToString(frameTimes.back()) + ".");
+
+        // Output the Vulkan command scope allocation rate, which should stay flat between runs
+        if(IsHostAllocatorEnabled()) {
+            HostAllocatorStats hostAllocatorStats = GetHostAllocatorStats();
+            console::OutMessageFunction((string)"Vulkan command scope host allocations per frame: " + ToString(hostAllocatorStats.averageFrameCommandAllocationCount) + " (" + ToString(hostAllocatorStats.averageFrameCommandAllocationSize) + " bytes).");
+        }
+    }
+
     int main(int argc, char** args) {
+        // The display settings given as console args are applied by the startup tasks, once the editor properties are loaded
+        StartupArgs startupArgs{};
+
         // Check for evety console arg
         for(int32_t i = 1; i < argc; ++i) {
             if(!strcmp(args[i], "--vkdebug")) {
                 EnableValidationLayers();
             } else if(!strcmp(args[i], "--novkdebug")) {
                 DisableValidationLayers();
+            } else if(!strcmp(args[i], "--presentonchange")) {
+                EnablePresentOnChange();
+            } else if(!strcmp(args[i], "--nopresentonchange")) {
+                DisablePresentOnChange();
+            } else if(!strcmp(args[i], "--bindless")) {
+                EnableBindlessRendering();
+            } else if(!strcmp(args[i], "--nobindless")) {
+                DisableBindlessRendering();
+            } else if(!strcmp(args[i], "--headless")) {
+                headless = true;
+            } else if(!strcmp(args[i], "--frames") && i + 1 < argc) {
+                headlessFrameCount = (size_t)strtoull(args[++i], nullptr, 10);
+            } else if(!strcmp(args[i], "--dumpframes") && i + 1 < argc) {
+                frameDumpDir = args[++i];
+            } else if(!strcmp(args[i], "--trace") && i + 1 < argc) {
+                traceFilename = args[++i];
+            } else if(!strcmp(args[i], "--presentmode") && i + 1 < argc) {
+                startupArgs.presentMode = args[++i];
+            } else if(!strcmp(args[i], "--swapchainimages") && i + 1 < argc) {
+                startupArgs.imageCount = args[++i];
+            } else if(!strcmp(args[i], "--fps") && i + 1 < argc) {
+                startupArgs.frameRate = args[++i];
+            } else if(!strcmp(args[i], "--swapchaindepth")) {
+                SwapChainAttachmentInfo attachmentInfo = GetSwapChainAttachmentInfo();
+                attachmentInfo.depthAttachment = true;
+                SetSwapChainAttachmentInfo(attachmentInfo);
+            } else if(!strcmp(args[i], "--nodynamicrendering")) {
+                DisableDynamicRendering();
+            } else if(!strcmp(args[i], "--nohostallocator")) {
+                DisableHostAllocator();
+            } else if(!strcmp(args[i], "--notimelinesemaphore")) {
+                DisableTimelineSemaphore();
+            } else if(!strcmp(args[i], "--startup-profile")) {
+                startupProfile = true;
             }
         }
+
+        // Draw every frame in headless mode, so every frame is timed
+        if(headless)
+            DisablePresentOnChange();
         
         // Create everything
         console::OpenLogFile();
+        SetProfilerThreadName("Main thread");
+
+        auto startupStartTime = std::chrono::steady_clock::now();
+        auto phaseStartTime = startupStartTime;
 
+        CreateThreadPool();
+        phaseStartTime = RecordStartupPhase("Thread pool", phaseStartTime);
         CreateImGui();
-        CreatePlatform();
-        CreateDevice();
-        CreateSwapChain();
+        phaseStartTime = RecordStartupPhase("ImGui context", phaseStartTime);
+
+        // Create the window, the device and the swap chain while the fonts are baked and the images are decoded on the other threads
+        ParallelFor(STARTUP_TASK_COUNT + GetStartupImageCount(), RunStartupTask, &startupArgs);
+        phaseStartTime = RecordStartupPhase("Parallel startup", phaseStartTime);
+
+        // The pipeline uploads the baked fonts and the decoded images, so it's created once every startup task is done
         CreateImGuiPipeline();
+        phaseStartTime = RecordStartupPhase("ImGui pipeline", phaseStartTime);
 
-        LoadEditorProperties();
         LoadWorkspace();
+        phaseStartTime = RecordStartupPhase("Workspace", phaseStartTime);
+
+        if(startupProfile)
+            OutputStartupProfile(std::chrono::duration<float64_t, std::milli>(phaseStartTime - startupStartTime).count());
 
         // Main message loop
         int32_t returnCode;
 
         while(running) {
+            auto frameStartTime = std::chrono::steady_clock::now();
+            MarkProfilerFrame();
+            MarkHostAllocatorFrame();
+
             // Poll events
-            PollPlatformEvents();
+            if(!headless) {
+                WFE_PROFILE_ZONE("PollPlatformEvents");
+                PollPlatformEvents();
+            }
 
             // Process the polled events
-            returnCode = ProcessEvents();
+            {
+                WFE_PROFILE_ZONE("ProcessEvents");
+                returnCode = ProcessEvents();
+            }
             if(!running)
                 break;
 
-            ProcessImGuiEvents();
+            {
+                WFE_PROFILE_ZONE("ProcessImGuiEvents");
+                ProcessImGuiEvents();
+            }
 
             // Start rendering the windows
             renderingWindows = true;
 
-            RenderWindows();
-            DrawImGui();
+            {
+                WFE_PROFILE_ZONE("RenderWindows");
+                RenderWindows();
+            }
+
+            // Submit the uploads queued while rendering the windows
+            {
+                WFE_PROFILE_ZONE("SubmitUploads");
+                SubmitUploads();
+            }
+
+            // Destroy the deferred resources whose frames finished, even if no frame is drawn
+            {
+                WFE_PROFILE_ZONE("DestroyDeferredResources");
+                DestroyDeferredResources();
+            }
+
+            // Recreate the swap chain if its recreation requests settled, then redraw the frame at the new size
+            {
+                WFE_PROFILE_ZONE("UpdateSwapChain");
+                if(UpdateSwapChain())
+                    RequestRedraw();
+            }
+
+            // Only draw and present the frame if its contents changed
+            bool8_t frameChanged = HasImGuiFrameChanged();
+            if(frameChanged) {
+                WFE_PROFILE_ZONE("DrawImGui");
+                DrawImGui();
+            }
 
             // Stop rendering the windows
             renderingWindows = false;
 
+            if(headless) {
+                // Time the frame, then dump it, if requested
+                auto frameEndTime = std::chrono::steady_clock::now();
+                frameTimes.push_back(std::chrono::duration<float64_t, std::milli>(frameEndTime - frameStartTime).count());
+
+                if(frameDumpDir.length())
+                    DumpFrame(frameTimes.size() - 1);
+                
+                // Exit once every requested frame was rendered
+                if(frameTimes.size() == headlessFrameCount)
+                    CloseApplication(0);
+            }
+
             // Remove all events from the queue
             RemoveAllEvents();
+
+            // Idle until new input arrives or one of ImGui's timers runs out if nothing changed and nothing is waiting to be processed.
+            // Pending uploads, swap chain recreations and deferred deletions are polled regularly, so they're applied as soon as they're ready
+            if(!headless && !frameChanged && !continuousUpdates && !HasQueuedEvents()) {
+                WFE_PROFILE_ZONE("WaitPlatformEvents");
+                WaitPlatformEvents((HasPendingUploads() || IsSwapChainRecreationPending() || GetDeferredDeletionCount()) ? PENDING_WORK_POLL_INTERVAL : GetImGuiIdleTimeout());
+            } else if(frameChanged)
+                LimitFrameRate();
+            
+            continuousUpdates = false;
+        }
+
+        if(headless)
+            OutputFrameTimes();
+        
+        // Export the profiler's trace, if requested
+        if(traceFilename.length()) {
+            if(ExportProfilerTrace(traceFilename))
+                console::OutMessageFunction((string)"Exported profiler trace to " + traceFilename + ".");
+            else
+                console::OutWarningFunction((string)"Failed to export profiler trace to " + traceFilename + "!");
         }
 
         // Delete everything
         DeleteImGuiPipeline();
         DeleteSwapChain();
+        DeleteGPUTimings();
         DeleteDevice();
-        DeletePlatform();
+        if(!headless)
+            DeletePlatform();
         DeleteImGui();
+        DeleteThreadPool();
+        DeleteProfiler();
 
         console::CloseLogFile();
 
@@ -159,6 +486,23 @@ namespace wfe::editor {
             // Add the event to the coresponding queue
             eventQueue[event.eventType].push_back(event);
         }
+
+        // Wake up the main loop, since the event has to be processed next frame
+        WakePlatform();
+    }
+
+    void RequestContinuousUpdates() {
+        continuousUpdates = true;
+
+        // Wake up the main loop in case it is already waiting
+        WakePlatform();
+    }
+
+    uint32_t GetTargetFrameRate() {
+        return targetFrameRate;
+    }
+    void SetTargetFrameRate(uint32_t newTargetFrameRate) {
+        targetFrameRate = newTargetFrameRate;
     }
 
     void CloseApplication(int32_t returnCode) {
@@ -180,6 +524,9 @@ namespace wfe::editor {
     bool8_t IsInsideEditor() {
         return true;
     }
+    bool8_t IsHeadless() {
+        return headless;
+    }
 
     size_t GetMainWindowWidth() {
         return mainWindowWidth;
@@ -1,16 +1,27 @@
 #include "General/ImGui.hpp"
 #include "General/Application.hpp"
+#include "Base/Window.hpp"
+#include "imgui_internal.hpp"
+
+#include <chrono>
 
 namespace wfe::editor {
     // Constants
     const float32_t FONT_SIZE = 13.f;
 
+    const float64_t MAX_IDLE_TIMEOUT = 1.0;        // The longest time the main loop can idle for
+    const float32_t CURSOR_BLINK_VISIBLE = .80f;   // The time the text cursor is visible for during a blink
+    const float32_t CURSOR_BLINK_PERIOD = 1.20f;   // The length of a text cursor blink
+    const float32_t TOOLTIP_HOVER_DELAY = .30f;    // The longest hover delay before ImGui shows a tooltip
+
     // Variables
     ImGuiContext* context;
     ImGuiIO* io;
     ImGuiStyle* style;
     ImFont* normalFont,* boldFont,* italicFont;
 
+    std::chrono::steady_clock::time_point lastFrameTime;
+
     // Public functions
     void CreateImGui() {
         // Check the ImGui version
@@ -34,6 +45,8 @@ namespace wfe::editor {
 
         io->DisplaySize = { (float32_t)GetMainWindowWidth(), (float32_t)GetMainWindowHeight() };
 
+        lastFrameTime = std::chrono::steady_clock::now();
+
         // Load the fonts
 #ifdef NDEBUG
         normalFont = io->Fonts->AddFontFromFileTTF("assets/fonts/Consola-Default.ttf", FONT_SIZE);
@@ -81,10 +94,22 @@ namespace wfe::editor {
         style->Colors[ImGuiCol_TitleBgActive]      = ImVec4{ .1700f, .1705f, .1710f, 1.f };
         style->Colors[ImGuiCol_TitleBgCollapsed]   = ImVec4{ .1500f, .1505f, .1510f, 1.f };
     }
+    void BakeImGuiFonts() {
+        // Build the font atlas now, so the pipeline doesn't have to when it reads the font texture
+        if(!io->Fonts->Build())
+            console::OutWarningFunction("Failed to bake the ImGui fonts!");
+    }
     void DeleteImGui() {
         ImGui::DestroyContext(context);
     }
     void ProcessImGuiEvents() {
+        // Set the delta time to the real time since the last frame, since frames aren't evenly spaced while idling
+        auto currentTime = std::chrono::steady_clock::now();
+        float32_t deltaTime = std::chrono::duration<float32_t>(currentTime - lastFrameTime).count();
+
+        io->DeltaTime = deltaTime > 0.f ? deltaTime : 1e-4f;
+        lastFrameTime = currentTime;
+
         // Process every key event
         auto keyEvents = GetEventsOfType(EVENT_TYPE_KEY);
 
@@ -133,6 +158,46 @@ namespace wfe::editor {
         }
     }
 
+    float64_t GetImGuiIdleTimeout() {
+        float64_t timeout = MAX_IDLE_TIMEOUT;
+
+        // Wake up for key and button repeats while anything is held down
+        for(int32_t key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; ++key)
+            if(ImGui::IsKeyDown((ImGuiKey)key))
+                return io->KeyRepeatRate;
+        
+        // Wake up when the text cursor blinks
+        if(io->WantTextInput && io->ConfigInputTextCursorBlink) {
+            float32_t cursorAnim = context->InputTextState.CursorAnim;
+            float32_t nextBlink;
+
+            if(cursorAnim < 0.f) {
+                nextBlink = CURSOR_BLINK_VISIBLE - cursorAnim;
+            } else {
+                float32_t blinkTime = ImFmod(cursorAnim, CURSOR_BLINK_PERIOD);
+                nextBlink = blinkTime < CURSOR_BLINK_VISIBLE ? CURSOR_BLINK_VISIBLE - blinkTime : CURSOR_BLINK_PERIOD - blinkTime;
+            }
+
+            if(nextBlink < timeout)
+                timeout = nextBlink;
+        }
+
+        // Wake up when the hovered item's tooltip is due
+        if(context->HoveredId && context->HoveredIdTimer < TOOLTIP_HOVER_DELAY) {
+            float32_t tooltipDelay = TOOLTIP_HOVER_DELAY - context->HoveredIdTimer;
+
+            if(tooltipDelay < timeout)
+                timeout = tooltipDelay;
+        }
+
+        // Wake up when a window's displayed values have to be refreshed
+        float64_t refreshTimeout = GetWindowRefreshTimeout();
+        if(refreshTimeout >= 0.0 && refreshTimeout < timeout)
+            timeout = refreshTimeout;
+
+        return timeout;
+    }
+
     ImGuiContext* GetImGuiContext() {
         return context;
     }
@@ -0,0 +1,131 @@
+#include "General/ImageWriter.hpp"
+
+namespace wfe::editor {
+    // Constants
+    const uint8_t PNG_SIGNATURE[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    const size_t MAX_STORED_BLOCK_SIZE = 65535;
+    const uint32_t ADLER_MODULO = 65521;
+
+    // Variables
+    uint32_t crcTable[256];
+    bool8_t crcTableCreated = false;
+
+    // Internal helper functions
+    static void CreateCRCTable() {
+        for(uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for(uint32_t j = 0; j < 8; ++j)
+                crc = (crc & 1) ? 0xedb88320 ^ (crc >> 1) : crc >> 1;
+            crcTable[i] = crc;
+        }
+
+        crcTableCreated = true;
+    }
+    static uint32_t UpdateCRC(uint32_t crc, const uint8_t* data, size_t size) {
+        for(size_t i = 0; i < size; ++i)
+            crc = crcTable[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        
+        return crc;
+    }
+    static void PushUInt32(vector<uint8_t>& buffer, uint32_t value) {
+        // PNG stores every multi-byte integer in big endian order
+        buffer.push_back((uint8_t)(value >> 24));
+        buffer.push_back((uint8_t)(value >> 16));
+        buffer.push_back((uint8_t)(value >> 8));
+        buffer.push_back((uint8_t)value);
+    }
+    static void WriteChunk(FileOutput& output, const char_t* type, const vector<uint8_t>& data) {
+        // Write the chunk's length, type and data
+        vector<uint8_t> header;
+        PushUInt32(header, (uint32_t)data.size());
+        for(size_t i = 0; i < 4; ++i)
+            header.push_back((uint8_t)type[i]);
+        
+        output.WriteBuffer((char_t*)header.data(), header.size());
+        if(!data.empty())
+            output.WriteBuffer((char_t*)data.data(), data.size());
+
+        // Write the CRC of the chunk's type and data
+        uint32_t crc = UpdateCRC(0xffffffff, header.data() + 4, 4);
+        crc = UpdateCRC(crc, data.data(), data.size()) ^ 0xffffffff;
+
+        vector<uint8_t> footer;
+        PushUInt32(footer, crc);
+
+        output.WriteBuffer((char_t*)footer.data(), footer.size());
+    }
+
+    // Public functions
+    bool8_t WritePNGFile(const string& filename, size_t width, size_t height, const void* data) {
+        if(!crcTableCreated)
+            CreateCRCTable();
+        
+        // Open the output file
+        FileOutput output(filename, (StreamType)(STREAM_TYPE_BINARY | STREAM_TYPE_TRUNCATE));
+        if(!output)
+            return false;
+        
+        output.WriteBuffer((char_t*)PNG_SIGNATURE, sizeof(PNG_SIGNATURE));
+
+        // Write the header chunk: 8 bits per channel, RGBA, no interlacing
+        vector<uint8_t> headerData;
+        PushUInt32(headerData, (uint32_t)width);
+        PushUInt32(headerData, (uint32_t)height);
+        headerData.push_back(8);
+        headerData.push_back(6);
+        headerData.push_back(0);
+        headerData.push_back(0);
+        headerData.push_back(0);
+
+        WriteChunk(output, "IHDR", headerData);
+
+        // Prefix every row with the "none" filter type
+        size_t rowSize = width * 4;
+        vector<uint8_t> rawData((rowSize + 1) * height);
+        
+        for(size_t y = 0; y < height; ++y) {
+            rawData[y * (rowSize + 1)] = 0;
+            memcpy(rawData.data() + y * (rowSize + 1) + 1, (const uint8_t*)data + y * rowSize, rowSize);
+        }
+
+        // Wrap the rows in a zlib stream made of stored deflate blocks, which skips compression entirely
+        vector<uint8_t> imageData;
+        imageData.push_back(0x78);
+        imageData.push_back(0x01);
+
+        for(size_t offset = 0; offset < rawData.size() || offset == 0; offset += MAX_STORED_BLOCK_SIZE) {
+            size_t blockSize = rawData.size() - offset;
+            if(blockSize > MAX_STORED_BLOCK_SIZE)
+                blockSize = MAX_STORED_BLOCK_SIZE;
+            
+            imageData.push_back(offset + blockSize == rawData.size());
+            imageData.push_back((uint8_t)blockSize);
+            imageData.push_back((uint8_t)(blockSize >> 8));
+            imageData.push_back((uint8_t)~blockSize);
+            imageData.push_back((uint8_t)(~blockSize >> 8));
+
+            size_t blockStart = imageData.size();
+            imageData.resize(blockStart + blockSize);
+            memcpy(imageData.data() + blockStart, rawData.data() + offset, blockSize);
+
+            if(!blockSize)
+                break;
+        }
+
+        // End the zlib stream with the Adler-32 checksum of the rows
+        uint32_t adlerA = 1, adlerB = 0;
+        for(uint8_t byte : rawData) {
+            adlerA = (adlerA + byte) % ADLER_MODULO;
+            adlerB = (adlerB + adlerA) % ADLER_MODULO;
+        }
+        PushUInt32(imageData, (adlerB << 16) | adlerA);
+
+        WriteChunk(output, "IDAT", imageData);
+        WriteChunk(output, "IEND", vector<uint8_t>());
+
+        bool8_t writeFailed = output.IsBad();
+        output.Close();
+
+        return !writeFailed;
+    }
+}
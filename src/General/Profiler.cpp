@@ -0,0 +1,298 @@
+#include "General/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace wfe::editor {
+    // Constants
+    const uint64_t PROFILER_RECORD_CAPACITY = 1 << 14; // The number of zones every thread's ring buffer holds; must be a power of two
+    const uint32_t MAX_PROFILER_ZONE_DEPTH = 64;       // The maximum depth of the recorded zones; deeper zones are ignored
+    const size_t PROFILER_FRAME_CAPACITY = 256;        // The number of frame starts remembered
+    const size_t MAX_PROFILER_THREAD_NAME_LENGTH = 32;
+
+    // Structs
+    struct ProfilerRecord {
+        const char_t* name;
+        uint64_t start;
+        uint64_t end;
+        uint32_t depth;
+    };
+    struct ProfilerOpenZone {
+        const char_t* name;
+        uint64_t start;
+    };
+    struct ProfilerThread {
+        char_t name[MAX_PROFILER_THREAD_NAME_LENGTH];
+        ProfilerRecord* records;
+        std::atomic<uint64_t> recordCount;
+        ProfilerOpenZone openZones[MAX_PROFILER_ZONE_DEPTH];
+        uint32_t depth;
+    };
+
+    // Variables
+    const std::chrono::steady_clock::time_point profilerEpoch = std::chrono::steady_clock::now();
+
+    std::mutex profilerThreadsMutex;
+    vector<ProfilerThread*> profilerThreads;
+    thread_local ProfilerThread* currentProfilerThread = nullptr;
+    thread_local char_t currentProfilerThreadName[MAX_PROFILER_THREAD_NAME_LENGTH] = "";
+
+    std::mutex profilerNamesMutex;
+    std::unordered_set<std::string_view> profilerNames;
+
+    uint64_t profilerFrameStarts[PROFILER_FRAME_CAPACITY];
+    uint64_t profilerFrameCount = 0;
+
+    // Internal helper functions
+    static inline uint64_t GetProfilerTime() {
+        // The steady clock is read through the vDSO on Linux, so it's cheap enough to read twice for every zone
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - profilerEpoch).count();
+    }
+    static ProfilerThread* GetCurrentProfilerThread() {
+        if(currentProfilerThread)
+            return currentProfilerThread;
+
+        // Create the current thread's ring buffer and register it
+        ProfilerThread* thread = new ProfilerThread();
+        thread->records = new ProfilerRecord[PROFILER_RECORD_CAPACITY];
+        thread->recordCount = 0;
+        thread->depth = 0;
+
+        std::lock_guard<std::mutex> lock(profilerThreadsMutex);
+
+        if(currentProfilerThreadName[0])
+            strcpy(thread->name, currentProfilerThreadName);
+        else
+            snprintf(thread->name, MAX_PROFILER_THREAD_NAME_LENGTH, "Thread %zu", profilerThreads.size());
+
+        profilerThreads.push_back(thread);
+        currentProfilerThread = thread;
+
+        return thread;
+    }
+    static void CopyThreadRecords(ProfilerThread* thread, vector<ProfilerRecord>& records) {
+        // Copy every record the ring buffer still holds
+        uint64_t recordEnd = thread->recordCount.load(std::memory_order_acquire);
+        uint64_t recordBegin = recordEnd > PROFILER_RECORD_CAPACITY ? recordEnd - PROFILER_RECORD_CAPACITY : 0;
+
+        records.resize((size_t)(recordEnd - recordBegin));
+        for(uint64_t i = recordBegin; i < recordEnd; ++i)
+            records[(size_t)(i - recordBegin)] = thread->records[i & (PROFILER_RECORD_CAPACITY - 1)];
+
+        // Drop the records the thread overwrote while they were being copied, including the slot of the record it may still be writing
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t newRecordEnd = thread->recordCount.load(std::memory_order_relaxed) + 1;
+        uint64_t validBegin = newRecordEnd > PROFILER_RECORD_CAPACITY ? newRecordEnd - PROFILER_RECORD_CAPACITY : 0;
+
+        if(validBegin > recordBegin) {
+            size_t overwrittenCount = (size_t)std::min(validBegin - recordBegin, recordEnd - recordBegin);
+            for(size_t i = overwrittenCount; i < records.size(); ++i)
+                records[i - overwrittenCount] = records[i];
+            records.resize(records.size() - overwrittenCount);
+        }
+    }
+    static size_t EscapeJSONString(const char_t* source, char_t* dest, size_t destSize) {
+        size_t length = 0;
+        for(; *source && length + 7 < destSize; ++source) {
+            uint8_t c = (uint8_t)*source;
+            if(c == '"' || c == '\\') {
+                dest[length++] = '\\';
+                dest[length++] = (char_t)c;
+            } else if(c < 0x20) {
+                length += snprintf(dest + length, destSize - length, "\\u%04x", c);
+            } else
+                dest[length++] = (char_t)c;
+        }
+        dest[length] = 0;
+
+        return length;
+    }
+
+    // Public functions
+    void DeleteProfiler() {
+        std::lock_guard<std::mutex> lock(profilerThreadsMutex);
+
+        // Delete every thread's ring buffer
+        for(auto* thread : profilerThreads) {
+            delete[] thread->records;
+            delete thread;
+        }
+        profilerThreads.clear();
+        currentProfilerThread = nullptr;
+
+        // Free every interned name
+        std::lock_guard<std::mutex> namesLock(profilerNamesMutex);
+        for(auto name : profilerNames)
+            free((void*)name.data());
+        profilerNames.clear();
+    }
+
+    void SetProfilerThreadName(const char_t* name) {
+        snprintf(currentProfilerThreadName, MAX_PROFILER_THREAD_NAME_LENGTH, "%s", name);
+
+        // Rename the thread's buffer, if it was already created
+        if(currentProfilerThread) {
+            std::lock_guard<std::mutex> lock(profilerThreadsMutex);
+            strcpy(currentProfilerThread->name, currentProfilerThreadName);
+        }
+    }
+    size_t GetProfilerThreadCount() {
+        std::lock_guard<std::mutex> lock(profilerThreadsMutex);
+        return profilerThreads.size();
+    }
+    const char_t* GetProfilerThreadName(size_t threadIndex) {
+        std::lock_guard<std::mutex> lock(profilerThreadsMutex);
+        return profilerThreads[threadIndex]->name;
+    }
+
+    const char_t* InternProfilerName(const char_t* name) {
+        std::lock_guard<std::mutex> lock(profilerNamesMutex);
+
+        // Return the stored copy, if it exists
+        auto result = profilerNames.find(std::string_view(name));
+        if(result != profilerNames.end())
+            return result->data();
+
+        // Store a new copy of the name
+        size_t nameLength = strlen(name);
+        char_t* nameCopy = (char_t*)malloc(nameLength + 1);
+        memcpy(nameCopy, name, nameLength + 1);
+
+        profilerNames.insert(std::string_view(nameCopy, nameLength));
+
+        return nameCopy;
+    }
+
+    void BeginProfilerZone(const char_t* name) {
+        ProfilerThread* thread = GetCurrentProfilerThread();
+
+        // Remember the zone's start, if it isn't too deep
+        if(thread->depth < MAX_PROFILER_ZONE_DEPTH) {
+            thread->openZones[thread->depth].name = name;
+            thread->openZones[thread->depth].start = GetProfilerTime();
+        }
+        ++thread->depth;
+    }
+    void EndProfilerZone() {
+        ProfilerThread* thread = currentProfilerThread;
+        if(!thread || !thread->depth)
+            return;
+
+        --thread->depth;
+        if(thread->depth >= MAX_PROFILER_ZONE_DEPTH)
+            return;
+
+        // Write the zone to the ring buffer, then publish it
+        uint64_t recordIndex = thread->recordCount.load(std::memory_order_relaxed);
+        ProfilerRecord& record = thread->records[recordIndex & (PROFILER_RECORD_CAPACITY - 1)];
+
+        record.name = thread->openZones[thread->depth].name;
+        record.start = thread->openZones[thread->depth].start;
+        record.end = GetProfilerTime();
+        record.depth = thread->depth;
+
+        thread->recordCount.store(recordIndex + 1, std::memory_order_release);
+    }
+    void MarkProfilerFrame() {
+        profilerFrameStarts[profilerFrameCount % PROFILER_FRAME_CAPACITY] = GetProfilerTime();
+        ++profilerFrameCount;
+    }
+
+    float64_t GetLastProfilerFrame(vector<ProfilerZoneInfo>& zones) {
+        zones.clear();
+
+        if(profilerFrameCount < 2)
+            return 0.0;
+
+        uint64_t frameStart = profilerFrameStarts[(profilerFrameCount - 2) % PROFILER_FRAME_CAPACITY];
+        uint64_t frameEnd = profilerFrameStarts[(profilerFrameCount - 1) % PROFILER_FRAME_CAPACITY];
+
+        std::lock_guard<std::mutex> lock(profilerThreadsMutex);
+
+        // Add every zone that overlaps the frame, clipped to the frame
+        vector<ProfilerRecord> records;
+        for(size_t threadIndex = 0; threadIndex < profilerThreads.size(); ++threadIndex) {
+            CopyThreadRecords(profilerThreads[threadIndex], records);
+
+            size_t firstZone = zones.size();
+            for(const auto& record : records) {
+                if(record.end <= frameStart || record.start >= frameEnd)
+                    continue;
+
+                uint64_t zoneStart = std::max(record.start, frameStart);
+                uint64_t zoneEnd = std::min(record.end, frameEnd);
+
+                ProfilerZoneInfo zone;
+                zone.name = record.name;
+                zone.start = (float64_t)(zoneStart - frameStart) * 1e-6;
+                zone.duration = (float64_t)(zoneEnd - zoneStart) * 1e-6;
+                zone.depth = record.depth;
+                zone.threadIndex = (uint32_t)threadIndex;
+
+                zones.push_back(zone);
+            }
+
+            // Records are written when their zones end, so sort the thread's zones by their start
+            std::sort(zones.data() + firstZone, zones.data() + zones.size(), [](const ProfilerZoneInfo& a, const ProfilerZoneInfo& b) {
+                return a.start < b.start || (a.start == b.start && a.depth < b.depth);
+            });
+        }
+
+        return (float64_t)(frameEnd - frameStart) * 1e-6;
+    }
+    bool8_t ExportProfilerTrace(const string& filename) {
+        // Open the output file
+        FileOutput output(filename, (StreamType)(STREAM_TYPE_BINARY | STREAM_TYPE_TRUNCATE));
+        if(!output)
+            return false;
+
+        char_t line[512];
+        char_t escapedName[256];
+        size_t lineLength;
+        bool8_t firstEvent = true;
+
+        const char_t* header = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        output.WriteBuffer((char_t*)header, strlen(header));
+
+        std::lock_guard<std::mutex> lock(profilerThreadsMutex);
+
+        // Write every thread's name and zones as complete events, with timestamps in microseconds
+        vector<ProfilerRecord> records;
+        for(size_t threadIndex = 0; threadIndex < profilerThreads.size(); ++threadIndex) {
+            EscapeJSONString(profilerThreads[threadIndex]->name, escapedName, sizeof(escapedName));
+            lineLength = snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"%s\"}}", firstEvent ? "" : ",\n", threadIndex, escapedName);
+            output.WriteBuffer(line, lineLength);
+            firstEvent = false;
+
+            CopyThreadRecords(profilerThreads[threadIndex], records);
+            for(const auto& record : records) {
+                EscapeJSONString(record.name, escapedName, sizeof(escapedName));
+                lineLength = snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}", escapedName, threadIndex, record.start * 1e-3, (record.end - record.start) * 1e-3);
+                output.WriteBuffer(line, lineLength);
+            }
+        }
+
+        // Write every remembered frame start as a global instant event
+        uint64_t firstFrame = profilerFrameCount > PROFILER_FRAME_CAPACITY ? profilerFrameCount - PROFILER_FRAME_CAPACITY : 0;
+        for(uint64_t i = firstFrame; i < profilerFrameCount; ++i) {
+            lineLength = snprintf(line, sizeof(line), "%s{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}", firstEvent ? "" : ",\n", profilerFrameStarts[i % PROFILER_FRAME_CAPACITY] * 1e-3);
+            output.WriteBuffer(line, lineLength);
+            firstEvent = false;
+        }
+
+        const char_t* footer = "\n]}\n";
+        output.WriteBuffer((char_t*)footer, strlen(footer));
+
+        bool8_t writeFailed = output.IsBad();
+        output.Close();
+
+        return !writeFailed;
+    }
+}
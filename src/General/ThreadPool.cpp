@@ -0,0 +1,127 @@
+#include "General/ThreadPool.hpp"
+#include "General/Profiler.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace wfe::editor {
+    // Variables
+    vector<std::thread*> workerThreads;
+    bool8_t stopWorkers = false;
+
+    std::mutex parallelForMutex;           // Makes sure only one parallel for runs at a time
+    std::mutex jobMutex;                   // Guards the current job and the worker wake ups
+    std::condition_variable jobStarted;    // Wakes up the worker threads when a job starts
+    std::condition_variable jobFinished;   // Wakes up the calling thread when every worker left the job
+    uint64_t jobGeneration = 0;            // Incremented every time a job starts
+    size_t activeWorkerCount = 0;          // The number of workers still running the current job
+
+    ParallelForFunction jobFunction;
+    void* jobUserData;
+    size_t jobCount;
+    std::atomic<size_t> jobNextIndex;
+
+    // Internal helper functions
+    static void RunJobIndices() {
+        WFE_PROFILE_ZONE("ParallelFor");
+
+        // Keep taking indices until every index was taken
+        for(size_t index = jobNextIndex.fetch_add(1); index < jobCount; index = jobNextIndex.fetch_add(1))
+            jobFunction(index, jobUserData);
+    }
+    static void WorkerThreadMain(size_t workerIndex) {
+        uint64_t lastGeneration = 0;
+
+        string threadName = (string)"Worker " + ToString(workerIndex);
+        SetProfilerThreadName(threadName.c_str());
+
+        while(true) {
+            // Wait for a new job or for the pool to stop
+            {
+                std::unique_lock<std::mutex> lock(jobMutex);
+                jobStarted.wait(lock, [&lastGeneration] { return stopWorkers || jobGeneration != lastGeneration; });
+
+                if(stopWorkers)
+                    return;
+
+                lastGeneration = jobGeneration;
+            }
+
+            RunJobIndices();
+
+            // Let the calling thread know if this was the last worker running the job
+            {
+                std::lock_guard<std::mutex> lock(jobMutex);
+                if(!--activeWorkerCount)
+                    jobFinished.notify_one();
+            }
+        }
+    }
+
+    // Public functions
+    void CreateThreadPool() {
+        // Leave one core for the main thread, which also runs jobs
+        size_t workerCount = (size_t)std::thread::hardware_concurrency();
+        if(workerCount)
+            --workerCount;
+
+        workerThreads.resize(workerCount);
+        for(size_t i = 0; i < workerCount; ++i)
+            workerThreads[i] = new std::thread(WorkerThreadMain, i);
+
+        console::OutMessageFunction((string)"Created " + ToString(workerCount) + " worker threads successfully.");
+    }
+    void DeleteThreadPool() {
+        // Tell every worker to stop
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            stopWorkers = true;
+        }
+        jobStarted.notify_all();
+
+        // Join and delete every worker
+        for(auto* workerThread : workerThreads) {
+            workerThread->join();
+            delete workerThread;
+        }
+        workerThreads.clear();
+        stopWorkers = false;
+
+        console::OutMessageFunction("Deleted worker threads successfully.");
+    }
+
+    size_t GetWorkerThreadCount() {
+        return workerThreads.size();
+    }
+    void ParallelFor(size_t count, ParallelForFunction function, void* userData) {
+        // Run the job on the calling thread if there are no workers or if it's too small to split
+        if(workerThreads.empty() || count < 2) {
+            for(size_t i = 0; i < count; ++i)
+                function(i, userData);
+            return;
+        }
+
+        std::lock_guard<std::mutex> parallelForLock(parallelForMutex);
+
+        // Start the job on every worker
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+
+            jobFunction = function;
+            jobUserData = userData;
+            jobCount = count;
+            jobNextIndex = 0;
+            activeWorkerCount = workerThreads.size();
+            ++jobGeneration;
+        }
+        jobStarted.notify_all();
+
+        // Help with the job, then wait for every worker to finish its last index
+        RunJobIndices();
+
+        std::unique_lock<std::mutex> lock(jobMutex);
+        jobFinished.wait(lock, [] { return !activeWorkerCount; });
+    }
+}
@@ -17,13 +17,19 @@ namespace wfe::editor {
         callbacks.setWorkspaceDir = SetWorkspaceDir;
         callbacks.closeWorkspace = CloseWorkspace;
 
+        callbacks.shouldRefreshWindow = ShouldRefreshWindow;
+
         callbacks.getEvents = GetEvents;
         callbacks.getEventsOfType = GetEventsOfType;
 
         callbacks.addEvent = AddEvent;
 
         callbacks.closeApplication = CloseApplication;
+        callbacks.requestContinuousUpdates = RequestContinuousUpdates;
+        callbacks.getTargetFrameRate = GetTargetFrameRate;
+        callbacks.setTargetFrameRate = SetTargetFrameRate;
         callbacks.isInsideEditor = IsInsideEditor;
+        callbacks.isHeadless = IsHeadless;
 
         callbacks.getMainWindowWidth = GetMainWindowWidth;
         callbacks.getMainWindowHeight = GetMainWindowHeight;
@@ -34,6 +40,7 @@ namespace wfe::editor {
         callbacks.createImGui = CreateImGui;
         callbacks.deleteImGui = DeleteImGui;
         callbacks.processImGuiEvents = ProcessImGuiEvents;
+        callbacks.getImGuiIdleTimeout = GetImGuiIdleTimeout;
 
         callbacks.getImGuiContext = GetImGuiContext;
         callbacks.getImGuiIO = GetImGuiIO;
@@ -47,9 +54,28 @@ namespace wfe::editor {
         callbacks.getImGuiBoldFont = GetImGuiBoldFont;
         callbacks.getImGuiItalicFont = GetImGuiItalicFont;
 
+        callbacks.createThreadPool = CreateThreadPool;
+        callbacks.deleteThreadPool = DeleteThreadPool;
+
+        callbacks.getWorkerThreadCount = GetWorkerThreadCount;
+        callbacks.parallelFor = ParallelFor;
+
+        callbacks.writePNGFile = WritePNGFile;
+
+        callbacks.setProfilerThreadName = SetProfilerThreadName;
+        callbacks.getProfilerThreadCount = GetProfilerThreadCount;
+        callbacks.getProfilerThreadName = GetProfilerThreadName;
+        callbacks.internProfilerName = InternProfilerName;
+        callbacks.beginProfilerZone = BeginProfilerZone;
+        callbacks.endProfilerZone = EndProfilerZone;
+        callbacks.getLastProfilerFrame = GetLastProfilerFrame;
+        callbacks.exportProfilerTrace = ExportProfilerTrace;
+
         callbacks.createPlatform = CreatePlatform;
         callbacks.deletePlatform = DeletePlatform;
         callbacks.pollPlatformEvents = PollPlatformEvents;
+        callbacks.waitPlatformEvents = WaitPlatformEvents;
+        callbacks.wakePlatform = WakePlatform;
         
         callbacks.getPlatformInfo = GetPlatformInfo;
 
@@ -70,8 +96,17 @@ namespace wfe::editor {
         callbacks.getSurface = GetSurface;
         callbacks.getGraphicsQueue = GetGraphicsQueue;
         callbacks.getPresentQueue = GetPresentQueue;
+        callbacks.getTransferQueue = GetTransferQueue;
+        callbacks.submitToQueue = SubmitToQueue;
+        callbacks.waitForQueueIdle = WaitForQueueIdle;
+        callbacks.waitForDeviceIdle = WaitForDeviceIdle;
+        callbacks.getPipelineCache = GetPipelineCache;
         callbacks.getPhysicalDeviceProperties = GetPhysicalDeviceProperties;
         callbacks.getPhysicalDeviceFeatures = GetPhysicalDeviceFeatures;
+        callbacks.getDescriptorIndexingFeatures = GetDescriptorIndexingFeatures;
+        callbacks.isDeviceExtensionEnabled = IsDeviceExtensionEnabled;
+        callbacks.isDynamicRenderingSupported = IsDynamicRenderingSupported;
+        callbacks.isTimelineSemaphoreSupported = IsTimelineSemaphoreSupported;
         callbacks.areValidationLayersEnabled = AreValidationLayersEnabled;
         callbacks.enableValidationLayers = EnableValidationLayers;
         callbacks.disableValidationLayers = DisableValidationLayers;
@@ -84,8 +119,28 @@ namespace wfe::editor {
 
         callbacks.createBuffer = CreateBuffer;
         callbacks.createImage = CreateImage;
+        callbacks.createBufferAllocation = CreateBuffer;
+        callbacks.createImageAllocation = CreateImage;
+        callbacks.beginCommandBatch = BeginCommandBatch;
+        callbacks.submitCommandBatch = SubmitCommandBatch;
+        callbacks.isCommandBatchComplete = IsCommandBatchComplete;
+        callbacks.waitForCommandBatch = WaitForCommandBatch;
         callbacks.beginSingleTimeCommands = BeginSingleTimeCommands;
+        callbacks.uploadImageData = UploadImageData;
+        callbacks.submitUploads = SubmitUploads;
+        callbacks.isUploadComplete = IsUploadComplete;
+        callbacks.waitForUpload = WaitForUpload;
+        callbacks.hasPendingUploads = HasPendingUploads;
+        callbacks.deferDestroyBuffer = DeferDestroyBuffer;
+        callbacks.deferDestroyImage = DeferDestroyImage;
+        callbacks.deferDestroyImageView = DeferDestroyImageView;
+        callbacks.deferFreeMemory = DeferFreeMemory;
+        callbacks.deferFreeMemoryAllocation = DeferFreeMemory;
+        callbacks.deferFreeDescriptorSet = DeferFreeDescriptorSet;
+        callbacks.deferDestroyPipeline = DeferDestroyPipeline;
+        callbacks.getDeferredDeletionCount = GetDeferredDeletionCount;
         callbacks.endSingleTimeCommands = EndSingleTimeCommands;
+        callbacks.allocateFrameCommandBuffer = AllocateFrameCommandBuffer;
         callbacks.copyBuffer = CopyBuffer;
         callbacks.copyImage = CopyImage;
         callbacks.copyBufferToImage = CopyBufferToImage;
@@ -97,16 +152,69 @@ namespace wfe::editor {
         callbacks.createImGuiPipeline = CreateImGuiPipeline;
         callbacks.deleteImGuiPipeline = DeleteImGuiPipeline;
         callbacks.drawImGui = DrawImGui;
+        callbacks.hasImGuiFrameChanged = HasImGuiFrameChanged;
+        callbacks.requestRedraw = RequestRedraw;
+        callbacks.isPresentOnChangeEnabled = IsPresentOnChangeEnabled;
+        callbacks.enablePresentOnChange = EnablePresentOnChange;
+        callbacks.disablePresentOnChange = DisablePresentOnChange;
+        callbacks.isBindlessRenderingEnabled = IsBindlessRenderingEnabled;
+        callbacks.enableBindlessRendering = EnableBindlessRendering;
+        callbacks.disableBindlessRendering = DisableBindlessRendering;
         
         callbacks.getImGuiPipeline = GetImGuiPipeline;
         callbacks.getImGuiPipelineLayout = GetImGuiPipelineLayout;
         callbacks.getImGuiCommandBuffer = GetImGuiCommandBuffer;
+        callbacks.getImGuiPipelineStats = GetImGuiPipelineStats;
 
         callbacks.getImGuiTexture = GetImGuiTexture;
+        callbacks.loadImGuiIcons = LoadImGuiIcons;
+        callbacks.registerImGuiTexture = RegisterImGuiTexture;
+        callbacks.loadImGuiTextures = LoadImGuiTextures;
+        callbacks.loadImGuiTexturesFromMemory = LoadImGuiTexturesFromMemory;
+        callbacks.updateImGuiTexture = UpdateImGuiTexture;
+        callbacks.releaseImGuiTexture = ReleaseImGuiTexture;
+
+        callbacks.areGPUTimingsSupported = AreGPUTimingsSupported;
+        callbacks.areWindowGPUTimingsEnabled = AreWindowGPUTimingsEnabled;
+        callbacks.enableWindowGPUTimings = EnableWindowGPUTimings;
+        callbacks.disableWindowGPUTimings = DisableWindowGPUTimings;
+
+        callbacks.beginGPUScope = BeginGPUScope;
+        callbacks.endGPUScope = EndGPUScope;
+
+        callbacks.getGPUTimings = GetGPUTimings;
+
+        callbacks.allocateMemory = AllocateMemory;
+        callbacks.freeMemory = FreeMemory;
+        callbacks.flushMemory = FlushMemory;
+
+        callbacks.getMemoryAllocatorStats = GetMemoryAllocatorStats;
+
+        callbacks.isHostAllocatorEnabled = IsHostAllocatorEnabled;
+        callbacks.getHostAllocatorStats = GetHostAllocatorStats;
+        callbacks.hostAllocationScopeToString = HostAllocationScopeToString;
 
         callbacks.createSwapChain = CreateSwapChain;
         callbacks.deleteSwapChain = DeleteSwapChain;
         callbacks.recreateSwapChain = RecreateSwapChain;
+        callbacks.requestSwapChainRecreation = RequestSwapChainRecreation;
+        callbacks.isSwapChainRecreationPending = IsSwapChainRecreationPending;
+        callbacks.updateSwapChain = UpdateSwapChain;
+        callbacks.getSwapChainStats = GetSwapChainStats;
+
+        callbacks.getSwapChainAttachmentInfo = GetSwapChainAttachmentInfo;
+        callbacks.setSwapChainAttachmentInfo = SetSwapChainAttachmentInfo;
+        callbacks.getSwapChainAttachmentCount = GetSwapChainAttachmentCount;
+        callbacks.isDynamicRenderingEnabled = IsDynamicRenderingEnabled;
+        callbacks.getPipelineRenderingCreateInfo = GetPipelineRenderingCreateInfo;
+        callbacks.beginSwapChainRendering = BeginSwapChainRendering;
+        callbacks.endSwapChainRendering = EndSwapChainRendering;
+        callbacks.isTimelineSemaphoreEnabled = IsTimelineSemaphoreEnabled;
+        callbacks.getFrameTimelineSemaphore = GetFrameTimelineSemaphore;
+        callbacks.getSubmittedFrameValue = GetSubmittedFrameValue;
+        callbacks.getCompletedFrameValue = GetCompletedFrameValue;
+        callbacks.hasGPUReachedFrame = HasGPUReachedFrame;
+        callbacks.waitForFrame = WaitForFrame;
         
         callbacks.getFrameBuffer = GetFrameBuffer;
         callbacks.getRenderPass = GetRenderPass;
@@ -117,12 +225,21 @@ namespace wfe::editor {
         callbacks.getSwapChainWidth = GetSwapChainWidth;
         callbacks.getSwapChainHeight = GetSwapChainHeight;
         callbacks.getCurrentFrame = GetCurrentFrame;
+        callbacks.getPresentMode = GetPresentMode;
+        callbacks.getPreferredPresentMode = GetPreferredPresentMode;
+        callbacks.setPreferredPresentMode = SetPreferredPresentMode;
+        callbacks.getPreferredImageCount = GetPreferredImageCount;
+        callbacks.setPreferredImageCount = SetPreferredImageCount;
+        callbacks.presentModeToString = PresentModeToString;
+        callbacks.stringToPresentMode = StringToPresentMode;
 
         callbacks.extentAspectRatio = ExtentAspectRatio;
         callbacks.findDepthFormat = FindDepthFormat;
 
         callbacks.acquireNextImage = AcquireNextImage;
+        callbacks.queueFrameCommandBuffer = QueueFrameCommandBuffer;
         callbacks.submitCommandBuffers = SubmitCommandBuffers;
+        callbacks.readLastFramePixels = ReadLastFramePixels;
 
         callbacks.loadEditorProperties = LoadEditorProperties;
         callbacks.saveEditorProperties = SaveEditorProperties;
@@ -0,0 +1,15 @@
+#version 450
+
+layout(constant_id = 0) const uint TEXTURE_COUNT = 1;
+
+layout(location = 0) in vec2 fragUvCoord;
+layout(location = 1) in vec4 fragColor;
+layout(location = 2) flat in uint fragTextureIndex;
+
+layout(location = 0) out vec4 outColor;
+
+layout(set = 0, binding = 0) uniform sampler2D imageTextures[TEXTURE_COUNT];
+
+void main() {
+    outColor = fragColor * texture(imageTextures[fragTextureIndex], fragUvCoord);
+}
\ No newline at end of file
@@ -1,25 +1,68 @@
 #include "Vulkan/Device.hpp"
+#include "Vulkan/SwapChain.hpp"
+#include "Vulkan/HostAllocator.hpp"
+#include "General/Application.hpp"
 #include "ProjectInfo.hpp"
 #include "EditorPlatform/Platform.hpp"
 
+#include <mutex>
+#include <stdio.h>
+
 namespace wfe::editor {
+    struct ThreadCommandPools {
+        VkCommandPool commandPools[MAX_FRAMES_IN_FLIGHT];
+        vector<VkCommandBuffer> commandBuffers[MAX_FRAMES_IN_FLIGHT];
+        size_t usedCommandBufferCounts[MAX_FRAMES_IN_FLIGHT];
+        VkCommandPool batchCommandPool;
+        std::mutex mutex; // Guards the frame command pools and their used counts, which are reset by the main thread
+    };
+    struct CommandBatch {
+        ThreadCommandPools* pools;
+        VkCommandBuffer commandBuffer;
+        VkFence fence;
+        uint64_t batch;
+        bool8_t recording;
+        uint32_t waiterCount;
+    };
+    struct UploadBatch {
+        VkCommandBuffer transferCommandBuffer;
+        VkCommandBuffer acquireCommandBuffer;
+        VkFence fence;
+        uint64_t upload;
+        VkDeviceSize ringEnd, ringSize;
+        vector<VkImageMemoryBarrier> acquireBarriers;
+        vector<VkBuffer> stagingBuffers;
+        vector<MemoryAllocation> stagingBufferAllocations;
+    };
+    struct DeferredDeletion {
+        VkObjectType type;
+        uint64_t handle;
+        VkDescriptorPool descriptorPool;
+        MemoryAllocation allocation;
+        uint64_t frame;
+    };
+
     // Constants
     const vector<const char_t*> validationLayers = { "VK_LAYER_KHRONOS_validation" };
-    const vector<const char_t*> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    const vector<const char_t*> swapChainDeviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
 
     const vector<const char_t*> requiredExtensions = {
-        // General extensions
-        VK_KHR_SURFACE_EXTENSION_NAME,
-        WFE_VK_PLATFORM_EXTENSION
-
 #ifndef NDEBUG
-        , VK_EXT_DEBUG_UTILS_EXTENSION_NAME
+        VK_EXT_DEBUG_UTILS_EXTENSION_NAME
 #endif
     };
-    const vector<const char_t*> optionalExtensions = { };
+    const vector<const char_t*> surfaceExtensions = { VK_KHR_SURFACE_EXTENSION_NAME, WFE_VK_PLATFORM_EXTENSION };
+    const vector<const char_t*> optionalExtensions = { VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME };
+    const vector<const char_t*> optionalDeviceExtensions = { VK_KHR_MAINTENANCE3_EXTENSION_NAME, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, VK_KHR_MULTIVIEW_EXTENSION_NAME, VK_KHR_MAINTENANCE2_EXTENSION_NAME, VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME, VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME };
+
+    const VkDeviceSize STAGING_RING_SIZE = 16777216;
+    const VkDeviceSize STAGING_RING_ALIGNMENT = 16;
+
+    const char_t* const PIPELINE_CACHE_FILENAME = "pipeline.cache";
+    const char_t* const PIPELINE_CACHE_TEMP_FILENAME = "pipeline.cache.tmp";
 
     // Variables
-    VkAllocationCallbacks* allocator = nullptr;
+    const VkAllocationCallbacks* allocator = nullptr;
  
 #ifdef NDEBUG
     bool8_t enableValidationLayers = false;
@@ -34,9 +77,43 @@ namespace wfe::editor {
     VkPhysicalDevice physicalDevice;
     VkPhysicalDeviceProperties physicalDeviceProperties;
     VkPhysicalDeviceFeatures physicalDeviceFeatures; 
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures;
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures;
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
+    vector<const char_t*> enabledDeviceExtensions;
     VkDevice device;
-    VkQueue graphicsQueue, presentQueue;
+    VkQueue graphicsQueue, presentQueue, transferQueue;
     VkCommandPool commandPool;
+    VkPipelineCache pipelineCache;
+    QueueFamilyIndices queueFamilyIndices;
+
+    vector<ThreadCommandPools*> threadCommandPools;
+    std::mutex threadCommandPoolsMutex;
+    std::mutex queueMutex; // Guards every queue, since the queues might be the same and Vulkan requires their use to be externally synchronized
+    thread_local ThreadCommandPools* currentThreadCommandPools = nullptr;
+
+    vector<CommandBatch*> commandBatches;
+    uint64_t nextCommandBatch = 1;
+    std::mutex commandBatchMutex;
+
+    VkCommandPool transferCommandPool, acquireCommandPool;
+    VkBuffer stagingRingBuffer;
+    MemoryAllocation stagingRingAllocation;
+    uint8_t* stagingRingMappedMemory;
+    VkDeviceSize stagingRingAlignment;
+    VkDeviceSize stagingRingHead = 0, stagingRingTail = 0, stagingRingUsed = 0;
+
+    UploadBatch* currentUploadBatch = nullptr;
+    vector<UploadBatch*> transferUploadBatches;
+    vector<UploadBatch*> transferredUploadBatches; // Batches whose transfer finished, waiting for their acquire barriers to be submitted
+    vector<UploadBatch*> acquireUploadBatches;
+    vector<UploadBatch*> freeUploadBatches;
+    uint64_t nextUpload = 1, completedUpload = 0;
+    std::mutex uploadMutex;
+
+    vector<DeferredDeletion> queuedDeletions;   // Deletions queued since the last frame was acquired, not yet tagged with a frame
+    vector<DeferredDeletion> deferredDeletions; // Deletions waiting for their frame to finish
+    std::mutex deferredDeletionMutex;
 
     // Debug callback
     static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageType, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData, void* pUserData) {
@@ -83,10 +160,15 @@ namespace wfe::editor {
         for(const auto& extension : availableExtensionProperties)
             availableExtensionSet.insert(extension.extensionName);
 
-        // Find all of the missing extensions
+        // Find all of the missing extensions; the surface extensions are only required when rendering to a window
+        vector<const char_t*> extensions = requiredExtensions;
+        if(!IsHeadless())
+            for(const auto* extension : surfaceExtensions)
+                extensions.push_back(extension);
+
         string missingExtensions = "";
 
-        for(const auto* extension : requiredExtensions)
+        for(const auto* extension : extensions)
             if(!availableExtensionSet.count(extension))
                 missingExtensions += (string)extension + "; ";
             else
@@ -141,6 +223,13 @@ namespace wfe::editor {
                 indices.graphicsFamilyHasValue = true;
             }
 
+            // Nothing is presented in headless mode, so the graphics queue family stands in for the present queue family
+            if(IsHeadless()) {
+                indices.presentFamily = indices.graphicsFamily;
+                indices.presentFamilyHasValue = indices.graphicsFamilyHasValue;
+                continue;
+            }
+
             VkBool32 presentSupport;
             auto result = vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, i, surface, &presentSupport);
             if(result != VK_SUCCESS)
@@ -152,6 +241,23 @@ namespace wfe::editor {
             }
         }
 
+        // Look for a transfer queue family without graphics support, preferring one without compute support,
+        // which is usually a dedicated copy engine. Fall back to the graphics queue family
+        indices.transferFamily = indices.graphicsFamily;
+        indices.transferFamilyHasValue = indices.graphicsFamilyHasValue;
+
+        bool8_t dedicatedTransferFamily = false;
+        for(uint32_t i = 0; i < queueFamilyCount && !dedicatedTransferFamily; ++i) {
+            if(!(queueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) || (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT))
+                continue;
+            
+            dedicatedTransferFamily = !(queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT);
+            if(dedicatedTransferFamily || indices.transferFamily == indices.graphicsFamily) {
+                indices.transferFamily = i;
+                indices.transferFamilyHasValue = true;
+            }
+        }
+
         return indices;
     }
     static SwapChainSupportDetails QuerySwapChainSupport(VkPhysicalDevice physicalDevice) {
@@ -193,13 +299,14 @@ namespace wfe::editor {
             availableExtensionSet.insert(extension.extensionName);
         
         // Return false if at least one extension is missing
-        for(const auto* extension : requiredExtensions)
-            if(!availableExtensionSet.count(extension))
-                return false;
+        if(!IsHeadless())
+            for(const auto* extension : swapChainDeviceExtensions)
+                if(!availableExtensionSet.count(extension))
+                    return false;
         
         // Count all available optional extensions
         optionalExtensionCount = 0;
-        for(const auto* extension : optionalExtensions)
+        for(const auto* extension : optionalDeviceExtensions)
             optionalExtensionCount += availableExtensionSet.count(extension);
 
         return true;
@@ -213,7 +320,8 @@ namespace wfe::editor {
         if(!indices.IsComplete())
             return false;
 
-        SwapChainSupportDetails supportDetails = QuerySwapChainSupport(physicalDevice);
+        // The swap chain only needs to be supported when rendering to a window
+        bool8_t swapChainAdequate = IsHeadless() || QuerySwapChainSupport(physicalDevice).IsAdequate();
 
         // Get the physical device properties and features
         VkPhysicalDeviceProperties properties;
@@ -224,7 +332,7 @@ namespace wfe::editor {
         // Calculate the score
         score += properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
 
-        return indices.IsComplete() && supportDetails.IsAdequate() && extensionsSupported;
+        return indices.IsComplete() && swapChainAdequate && extensionsSupported;
     }
     static void SetStageAndAccess(VkImageLayout layout, VkAccessFlags& accessMask, VkPipelineStageFlags& stage) {
         // Check for every supported layout
@@ -330,6 +438,12 @@ namespace wfe::editor {
         console::OutMessageFunction("Created Vulkan debug messenger successfully.");
     }
     static void CreateSurface() {
+        // Exit the function if there is no window to create a surface for
+        if(IsHeadless()) {
+            surface = VK_NULL_HANDLE;
+            return;
+        }
+
         auto result = CreatePlatformSurface(instance, allocator, &surface);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to create surface! Error code: " + VkResultToString(result), 1);
@@ -361,35 +475,152 @@ namespace wfe::editor {
 
         console::OutMessageFunction((string)"Found suitable GPU: " + physicalDeviceProperties.deviceName + ".");
     }
+    static bool8_t IsInstanceExtensionEnabled(const char_t* extensionName) {
+        for(const auto* extension : enabledExtensions)
+            if(!strcmp(extension, extensionName))
+                return true;
+        
+        return false;
+    }
+    static void FindEnabledDeviceExtensions() {
+        // Get all device extensions
+        uint32_t availableExtensionCount;
+        vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableExtensionCount, nullptr);
+        vector<VkExtensionProperties> availableExtensions(availableExtensionCount);
+        vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableExtensionCount, availableExtensions.data());
+
+        // Put all available extensions in an unordered set
+        unordered_set<string> availableExtensionSet;
+        for(const auto& extension : availableExtensions)
+            availableExtensionSet.insert(extension.extensionName);
+        
+        // Descriptor indexing depends on the maintenance 3 and the physical device properties 2 extensions
+        if(!availableExtensionSet.count(VK_KHR_MAINTENANCE3_EXTENSION_NAME) || !IsInstanceExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME))
+            availableExtensionSet.remove(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+        
+        // Dynamic rendering depends on the depth stencil resolve extension, which depends on the create render pass 2 extension,
+        // which depends on the multiview and maintenance 2 extensions, and on the physical device properties 2 extension
+        if(!availableExtensionSet.count(VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME) || !availableExtensionSet.count(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME) || !availableExtensionSet.count(VK_KHR_MULTIVIEW_EXTENSION_NAME) || !availableExtensionSet.count(VK_KHR_MAINTENANCE2_EXTENSION_NAME) || !IsInstanceExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME))
+            availableExtensionSet.remove(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+        
+        // Timeline semaphores depend on the physical device properties 2 extension
+        if(!IsInstanceExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME))
+            availableExtensionSet.remove(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+
+        // Enable every required extension and every available optional extension
+        enabledDeviceExtensions.clear();
+        if(!IsHeadless())
+            enabledDeviceExtensions = swapChainDeviceExtensions;
+        for(const auto* extension : optionalDeviceExtensions)
+            if(availableExtensionSet.count(extension))
+                enabledDeviceExtensions.push_back(extension);
+    }
+    static void FindEnabledDeviceFeatures() {
+        // Set the enabled feature structs' types; every feature is disabled unless it's supported
+        descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+        descriptorIndexingFeatures.pNext = nullptr;
+        dynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+        dynamicRenderingFeatures.pNext = nullptr;
+        timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timelineSemaphoreFeatures.pNext = nullptr;
+
+        // Chain a struct for every enabled extension's features, so they are all queried at once
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT supportedDescriptorIndexingFeatures;
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR supportedDynamicRenderingFeatures;
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR supportedTimelineSemaphoreFeatures;
+
+        void* featureChain = nullptr;
+        if(IsDeviceExtensionEnabled(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) {
+            supportedTimelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+            supportedTimelineSemaphoreFeatures.pNext = featureChain;
+            featureChain = &supportedTimelineSemaphoreFeatures;
+        }
+        if(IsDeviceExtensionEnabled(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME)) {
+            supportedDynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+            supportedDynamicRenderingFeatures.pNext = featureChain;
+            featureChain = &supportedDynamicRenderingFeatures;
+        }
+        if(IsDeviceExtensionEnabled(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME)) {
+            supportedDescriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+            supportedDescriptorIndexingFeatures.pNext = featureChain;
+            featureChain = &supportedDescriptorIndexingFeatures;
+        }
+
+        // Exit the function if no extension features have to be queried
+        if(!featureChain)
+            return;
+        
+        auto getFeatures2Function = (PFN_vkGetPhysicalDeviceFeatures2KHR)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures2KHR");
+        if(!getFeatures2Function)
+            return;
+        
+        // Query the supported features
+        VkPhysicalDeviceFeatures2KHR features2;
+
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+        features2.pNext = featureChain;
+
+        getFeatures2Function(physicalDevice, &features2);
+
+        // Only enable the features the editor uses
+        if(IsDeviceExtensionEnabled(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+            descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = supportedDescriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing;
+        if(IsDeviceExtensionEnabled(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+            dynamicRenderingFeatures.dynamicRendering = supportedDynamicRenderingFeatures.dynamicRendering;
+        if(IsDeviceExtensionEnabled(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+            timelineSemaphoreFeatures.timelineSemaphore = supportedTimelineSemaphoreFeatures.timelineSemaphore;
+    }
     static void CreateLogicalDevice() {
-        // Set the device queue create info
+        // Find the enabled device extensions and features
+        FindEnabledDeviceExtensions();
+        FindEnabledDeviceFeatures();
+
+        // Chain the enabled extension feature structs
+        void* featureChain = nullptr;
+        if(IsDeviceExtensionEnabled(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) {
+            timelineSemaphoreFeatures.pNext = featureChain;
+            featureChain = &timelineSemaphoreFeatures;
+        }
+        if(IsDeviceExtensionEnabled(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME)) {
+            dynamicRenderingFeatures.pNext = featureChain;
+            featureChain = &dynamicRenderingFeatures;
+        }
+        if(IsDeviceExtensionEnabled(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME)) {
+            descriptorIndexingFeatures.pNext = featureChain;
+            featureChain = &descriptorIndexingFeatures;
+        }
+
+        // Set the device queue create infos, one for every unique queue family
         QueueFamilyIndices indices = FindQueueFamilies(physicalDevice);
+        queueFamilyIndices = indices;
         float32_t queuePriority = 1.f;
 
-        VkDeviceQueueCreateInfo queueCreateInfos[2];
-        uint32_t queueCount = indices.graphicsFamily != indices.presentFamily + 1;
-
-        queueCreateInfos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        queueCreateInfos[0].pNext = nullptr;
-        queueCreateInfos[0].flags = 0;
-        queueCreateInfos[0].queueFamilyIndex = indices.graphicsFamily;
-        queueCreateInfos[0].queueCount = 1;
-        queueCreateInfos[0].pQueuePriorities = &queuePriority;
-
-        if(queueCount == 2) {
-            queueCreateInfos[1].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-            queueCreateInfos[1].pNext = nullptr;
-            queueCreateInfos[1].flags = 0;
-            queueCreateInfos[1].queueFamilyIndex = indices.presentFamily;
-            queueCreateInfos[1].queueCount = 1;
-            queueCreateInfos[1].pQueuePriorities = &queuePriority;
+        uint32_t queueFamilies[] = { indices.graphicsFamily, indices.presentFamily, indices.transferFamily };
+        VkDeviceQueueCreateInfo queueCreateInfos[3];
+        uint32_t queueCount = 0;
+
+        for(uint32_t i = 0; i < 3; ++i) {
+            // Skip the queue family if it was already added
+            bool8_t duplicate = false;
+            for(uint32_t j = 0; j < queueCount; ++j)
+                duplicate |= queueCreateInfos[j].queueFamilyIndex == queueFamilies[i];
+            if(duplicate)
+                continue;
+            
+            queueCreateInfos[queueCount].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            queueCreateInfos[queueCount].pNext = nullptr;
+            queueCreateInfos[queueCount].flags = 0;
+            queueCreateInfos[queueCount].queueFamilyIndex = queueFamilies[i];
+            queueCreateInfos[queueCount].queueCount = 1;
+            queueCreateInfos[queueCount].pQueuePriorities = &queuePriority;
+            ++queueCount;
         }
 
         // Set the device create info
         VkDeviceCreateInfo createInfo;
 
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext = nullptr;
+        createInfo.pNext = featureChain;
         createInfo.flags = 0;
         createInfo.queueCreateInfoCount = queueCount;
         createInfo.pQueueCreateInfos = queueCreateInfos;
@@ -402,8 +633,8 @@ namespace wfe::editor {
             createInfo.ppEnabledLayerNames = nullptr;
         }
 
-        createInfo.enabledExtensionCount = (uint32_t)deviceExtensions.size();
-        createInfo.ppEnabledExtensionNames = deviceExtensions.data();
+        createInfo.enabledExtensionCount = (uint32_t)enabledDeviceExtensions.size();
+        createInfo.ppEnabledExtensionNames = enabledDeviceExtensions.data();
         createInfo.pEnabledFeatures = &physicalDeviceFeatures;
 
         // Create the device
@@ -415,6 +646,10 @@ namespace wfe::editor {
         // Get the device queues
         vkGetDeviceQueue(device, indices.graphicsFamily, 0, &graphicsQueue);
         vkGetDeviceQueue(device, indices.presentFamily, 0, &presentQueue);
+        vkGetDeviceQueue(device, indices.transferFamily, 0, &transferQueue);
+
+        if(indices.transferFamily != indices.graphicsFamily)
+            console::OutMessageFunction((string)"Using queue family " + ToString(indices.transferFamily) + " for transfers.");
     }
     static void CreateCommandPool() {
         QueueFamilyIndices indices = FindQueueFamilies(physicalDevice);
@@ -433,19 +668,620 @@ namespace wfe::editor {
         console::OutMessageFunction("Created Vulkan command pool successfully.");
     }
 
+    static bool8_t IsPipelineCacheDataValid(const uint8_t* data, size_t size) {
+        // Make sure the data holds a full header
+        if(size < 16 + VK_UUID_SIZE)
+            return false;
+        
+        // Read the header's values
+        uint32_t headerSize, headerVersion, vendorID, deviceID;
+
+        memcpy(&headerSize, data, sizeof(uint32_t));
+        memcpy(&headerVersion, data + 4, sizeof(uint32_t));
+        memcpy(&vendorID, data + 8, sizeof(uint32_t));
+        memcpy(&deviceID, data + 12, sizeof(uint32_t));
+
+        // Check if the cache was written by the same driver for the same device
+        return headerSize >= 16 + VK_UUID_SIZE && headerSize <= size && 
+               headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && 
+               vendorID == physicalDeviceProperties.vendorID && 
+               deviceID == physicalDeviceProperties.deviceID && 
+               !memcmp(data + 16, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    }
+    static void CreatePipelineCache() {
+        // Load the previous run's pipeline cache, if it exists
+        vector<uint8_t> cacheData;
+        FileInput input(PIPELINE_CACHE_FILENAME, STREAM_TYPE_BINARY);
+
+        if(input) {
+            input.Seek(0, SEEK_RELATIVE_END);
+            cacheData.resize(input.Tell());
+            input.Seek(0, SEEK_RELATIVE_BEGINNING);
+
+            if(!cacheData.empty())
+                input.ReadBuffer((char_t*)cacheData.data(), cacheData.size());
+            
+            input.Close();
+        }
+
+        // Discard the cache if it's corrupted or it was written for a different device or driver
+        if(!cacheData.empty() && !IsPipelineCacheDataValid(cacheData.data(), cacheData.size())) {
+            console::OutWarningFunction("Pipeline cache is invalid or was created for a different device or driver; it will be discarded.");
+            cacheData.clear();
+        }
+
+        // Set the pipeline cache create info
+        VkPipelineCacheCreateInfo createInfo;
+
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.initialDataSize = cacheData.size();
+        createInfo.pInitialData = cacheData.empty() ? nullptr : cacheData.data();
+
+        // Create the pipeline cache
+        auto result = vkCreatePipelineCache(device, &createInfo, allocator, &pipelineCache);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create pipeline cache! Error code: " + VkResultToString(result), 1);
+        
+        if(cacheData.empty())
+            console::OutMessageFunction("Created empty Vulkan pipeline cache successfully.");
+        else
+            console::OutMessageFunction((string)"Loaded Vulkan pipeline cache (" + ToString(cacheData.size()) + " bytes) successfully.");
+    }
+    static void SavePipelineCache() {
+        // Get the pipeline cache's data
+        size_t cacheSize;
+        auto result = vkGetPipelineCacheData(device, pipelineCache, &cacheSize, nullptr);
+        if(result != VK_SUCCESS) {
+            console::OutWarningFunction((string)"Failed to get pipeline cache data! Error code: " + VkResultToString(result));
+            return;
+        }
+
+        vector<uint8_t> cacheData(cacheSize);
+        result = vkGetPipelineCacheData(device, pipelineCache, &cacheSize, cacheData.data());
+        if(result != VK_SUCCESS) {
+            console::OutWarningFunction((string)"Failed to get pipeline cache data! Error code: " + VkResultToString(result));
+            return;
+        }
+
+        // Write the data to a temporary file, then replace the old cache with it, so an interrupted write never leaves a partial cache behind
+        FileOutput output(PIPELINE_CACHE_TEMP_FILENAME, (StreamType)(STREAM_TYPE_BINARY | STREAM_TYPE_TRUNCATE));
+        if(!output) {
+            console::OutWarningFunction("Failed to open pipeline cache file for writing!");
+            return;
+        }
+
+        output.WriteBuffer((char_t*)cacheData.data(), cacheSize);
+        bool8_t writeFailed = output.IsBad();
+        output.Close();
+
+        if(writeFailed || rename(PIPELINE_CACHE_TEMP_FILENAME, PIPELINE_CACHE_FILENAME)) {
+            console::OutWarningFunction("Failed to write pipeline cache file!");
+            remove(PIPELINE_CACHE_TEMP_FILENAME);
+            return;
+        }
+
+        console::OutMessageFunction((string)"Saved Vulkan pipeline cache (" + ToString(cacheSize) + " bytes) successfully.");
+    }
+    static ThreadCommandPools* GetThreadCommandPools() {
+        // Return the calling thread's command pools if they were already created
+        if(currentThreadCommandPools)
+            return currentThreadCommandPools;
+        
+        QueueFamilyIndices indices = FindQueueFamilies(physicalDevice);
+
+        // Set the command pool create info; the pools are only ever reset as a whole
+        VkCommandPoolCreateInfo createInfo;
+
+        createInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        createInfo.queueFamilyIndex = indices.graphicsFamily;
+
+        // Create one command pool for every frame in flight
+        ThreadCommandPools* pools = new ThreadCommandPools();
+
+        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
+            auto result = vkCreateCommandPool(device, &createInfo, allocator, pools->commandPools + i);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to create frame command pool! Error code: " + VkResultToString(result), 1);
+            pools->usedCommandBufferCounts[i] = 0;
+        }
+
+        // Create the command batch pool, whose command buffers are reset one at a time once their batch completes
+        createInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+        auto result = vkCreateCommandPool(device, &createInfo, allocator, &pools->batchCommandPool);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create command batch pool! Error code: " + VkResultToString(result), 1);
+
+        // Register the thread's command pools
+        {
+            std::lock_guard<std::mutex> lock(threadCommandPoolsMutex);
+            threadCommandPools.push_back(pools);
+        }
+
+        currentThreadCommandPools = pools;
+        return pools;
+    }
+    static void DeleteThreadCommandPools() {
+        std::lock_guard<std::mutex> lock(threadCommandPoolsMutex);
+
+        // Destroy every command batch's fence; their command buffers are freed alongside their pools
+        for(auto* commandBatch : commandBatches) {
+            vkDestroyFence(device, commandBatch->fence, allocator);
+            delete commandBatch;
+        }
+        commandBatches.clear();
+
+        // Destroy every thread's command pools, which also frees all of their command buffers
+        for(auto* pools : threadCommandPools) {
+            for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+                vkDestroyCommandPool(device, pools->commandPools[i], allocator);
+            vkDestroyCommandPool(device, pools->batchCommandPool, allocator);
+            delete pools;
+        }
+
+        threadCommandPools.clear();
+        currentThreadCommandPools = nullptr;
+    }
+
+    static CommandBatch* FindCommandBatch(uint64_t batch) {
+        for(auto* commandBatch : commandBatches)
+            if(batch && commandBatch->batch == batch)
+                return commandBatch;
+        
+        return nullptr;
+    }
+    static CommandBatch* GetFreeCommandBatch(ThreadCommandPools* pools) {
+        // Recycle one of the thread's batches that isn't recording and isn't in flight, if one is available
+        for(auto* commandBatch : commandBatches) {
+            if(commandBatch->pools != pools || commandBatch->recording || commandBatch->waiterCount)
+                continue;
+            if(commandBatch->batch && vkGetFenceStatus(device, commandBatch->fence) != VK_SUCCESS)
+                continue;
+            
+            return commandBatch;
+        }
+
+        // Set the command buffer allocate info
+        VkCommandBufferAllocateInfo allocateInfo;
+
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.pNext = nullptr;
+        allocateInfo.commandPool = pools->batchCommandPool;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.commandBufferCount = 1;
+
+        // Allocate the new batch's command buffer
+        CommandBatch* commandBatch = new CommandBatch();
+        commandBatch->pools = pools;
+        commandBatch->batch = 0;
+        commandBatch->recording = false;
+        commandBatch->waiterCount = 0;
+
+        auto result = vkAllocateCommandBuffers(device, &allocateInfo, &commandBatch->commandBuffer);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to allocate command buffer! Error code: " + VkResultToString(result), 1);
+        
+        // Set the fence create info
+        VkFenceCreateInfo fenceInfo;
+
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceInfo.pNext = nullptr;
+        fenceInfo.flags = 0;
+
+        // Create the batch's fence
+        result = vkCreateFence(device, &fenceInfo, allocator, &commandBatch->fence);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create command batch fence! Error code: " + VkResultToString(result), 1);
+        
+        commandBatches.push_back(commandBatch);
+        return commandBatch;
+    }
+
+    static void CreateUploadService() {
+        // Set the command pool create info for the transfer queue family
+        VkCommandPoolCreateInfo createInfo;
+
+        createInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        createInfo.queueFamilyIndex = queueFamilyIndices.transferFamily;
+
+        // Create the transfer command pool
+        auto result = vkCreateCommandPool(device, &createInfo, allocator, &transferCommandPool);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create transfer command pool! Error code: " + VkResultToString(result), 1);
+        
+        // Create the command pool for acquiring ownership of the uploaded images on the graphics queue family
+        createInfo.queueFamilyIndex = queueFamilyIndices.graphicsFamily;
+
+        result = vkCreateCommandPool(device, &createInfo, allocator, &acquireCommandPool);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create acquire command pool! Error code: " + VkResultToString(result), 1);
+
+        // Create the staging ring buffer and keep it mapped for its entire lifetime
+        CreateBuffer(STAGING_RING_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, stagingRingBuffer, stagingRingAllocation);
+        stagingRingMappedMemory = (uint8_t*)stagingRingAllocation.mappedMemory;
+        
+        // Align every allocation to the non coherent atom size as well, so every allocation can be flushed on its own
+        stagingRingAlignment = STAGING_RING_ALIGNMENT;
+        if(physicalDeviceProperties.limits.nonCoherentAtomSize > stagingRingAlignment)
+            stagingRingAlignment = physicalDeviceProperties.limits.nonCoherentAtomSize;
+    }
+    static void DestroyUploadBatchStagingBuffers(UploadBatch* batch) {
+        for(size_t i = 0; i < batch->stagingBuffers.size(); ++i) {
+            vkDestroyBuffer(device, batch->stagingBuffers[i], allocator);
+            FreeMemory(batch->stagingBufferAllocations[i]);
+        }
+
+        batch->stagingBuffers.clear();
+        batch->stagingBufferAllocations.clear();
+    }
+    static void DeleteUploadService() {
+        // Wait for every upload to finish
+        WaitForQueueIdle(transferQueue);
+        WaitForQueueIdle(graphicsQueue);
+
+        // Delete every upload batch
+        if(currentUploadBatch)
+            freeUploadBatches.push_back(currentUploadBatch);
+        for(auto* batch : transferUploadBatches)
+            freeUploadBatches.push_back(batch);
+        for(auto* batch : transferredUploadBatches)
+            freeUploadBatches.push_back(batch);
+        for(auto* batch : acquireUploadBatches)
+            freeUploadBatches.push_back(batch);
+
+        for(auto* batch : freeUploadBatches) {
+            DestroyUploadBatchStagingBuffers(batch);
+            vkDestroyFence(device, batch->fence, allocator);
+            delete batch;
+        }
+
+        currentUploadBatch = nullptr;
+        transferUploadBatches.clear();
+        transferredUploadBatches.clear();
+        acquireUploadBatches.clear();
+        freeUploadBatches.clear();
+
+        // Destroy the staging ring buffer and the command pools, which also frees all of their command buffers
+        vkDestroyBuffer(device, stagingRingBuffer, allocator);
+        FreeMemory(stagingRingAllocation);
+
+        vkDestroyCommandPool(device, transferCommandPool, allocator);
+        vkDestroyCommandPool(device, acquireCommandPool, allocator);
+    }
+    static UploadBatch* CreateUploadBatch() {
+        UploadBatch* batch = new UploadBatch();
+
+        // Set the command buffer alloc info
+        VkCommandBufferAllocateInfo allocInfo;
+
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext = nullptr;
+        allocInfo.commandPool = transferCommandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+
+        // Allocate the batch's command buffers
+        auto result = vkAllocateCommandBuffers(device, &allocInfo, &batch->transferCommandBuffer);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to allocate command buffer! Error code: " + VkResultToString(result), 1);
+        
+        allocInfo.commandPool = acquireCommandPool;
+
+        result = vkAllocateCommandBuffers(device, &allocInfo, &batch->acquireCommandBuffer);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to allocate command buffer! Error code: " + VkResultToString(result), 1);
+        
+        // Set the fence create info
+        VkFenceCreateInfo fenceInfo;
+
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceInfo.pNext = nullptr;
+        fenceInfo.flags = 0;
+
+        // Create the batch's fence
+        result = vkCreateFence(device, &fenceInfo, allocator, &batch->fence);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create fence! Error code: " + VkResultToString(result), 1);
+        
+        return batch;
+    }
+    static void BeginUploadBatch() {
+        // Exit the function if a batch is already being recorded
+        if(currentUploadBatch)
+            return;
+        
+        // Reuse a finished batch if possible
+        if(freeUploadBatches.size()) {
+            currentUploadBatch = freeUploadBatches.back();
+            freeUploadBatches.pop_back();
+        } else
+            currentUploadBatch = CreateUploadBatch();
+        
+        currentUploadBatch->upload = nextUpload;
+        currentUploadBatch->ringSize = 0;
+        currentUploadBatch->acquireBarriers.clear();
+
+        // Set the begin info
+        VkCommandBufferBeginInfo beginInfo;
+
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext = nullptr;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo = nullptr;
+
+        // Begin recording the transfer command buffer
+        auto result = vkBeginCommandBuffer(currentUploadBatch->transferCommandBuffer, &beginInfo);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to begin recording command buffer! Error code: " + VkResultToString(result), 1);
+    }
+    static void SubmitUploadBatch(UploadBatch* batch, VkCommandBuffer commandBuffer, VkQueue queue) {
+        // End recording the command buffer
+        auto result = vkEndCommandBuffer(commandBuffer);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to end recording command buffer! Error code: " + VkResultToString(result), 1);
+
+        // Set the command buffer submit info
+        VkSubmitInfo submitInfo;
+
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext = nullptr;
+        submitInfo.waitSemaphoreCount = 0;
+        submitInfo.pWaitSemaphores = nullptr;
+        submitInfo.pWaitDstStageMask = nullptr;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores = nullptr;
+
+        // Submit the command buffer, signaling the batch's fence
+        result = vkResetFences(device, 1, &batch->fence);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to reset fence! Error code: " + VkResultToString(result), 1);
+
+        result = SubmitToQueue(queue, 1, &submitInfo, batch->fence);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to submit to queue! Error code: " + VkResultToString(result), 1);
+    }
+    static void SubmitCurrentUploadBatch() {
+        // Exit the function if no uploads were queued
+        if(!currentUploadBatch)
+            return;
+        
+        // Submit the batch to the transfer queue
+        currentUploadBatch->ringEnd = stagingRingHead;
+        SubmitUploadBatch(currentUploadBatch, currentUploadBatch->transferCommandBuffer, transferQueue);
+
+        transferUploadBatches.push_back(currentUploadBatch);
+        currentUploadBatch = nullptr;
+        ++nextUpload;
+    }
+    static bool8_t UpdateTransferUploadBatches(bool8_t wait) {
+        // Exit the function if no batches are being transferred
+        if(transferUploadBatches.empty())
+            return false;
+
+        // Batches are submitted to the same queue, so they are checked in submission order
+        UploadBatch* batch = transferUploadBatches[0];
+
+        if(wait) {
+            auto result = vkWaitForFences(device, 1, &batch->fence, VK_TRUE, UINT64_MAX);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to wait for fence! Error code: " + VkResultToString(result), 1);
+        } else if(vkGetFenceStatus(device, batch->fence) != VK_SUCCESS)
+            return false;
+        
+        // Remove the batch from the list
+        for(size_t i = 1; i < transferUploadBatches.size(); ++i)
+            transferUploadBatches[i - 1] = transferUploadBatches[i];
+        transferUploadBatches.pop_back();
+
+        // Free the batch's staging memory; its acquire barriers are submitted separately, since this might run on any thread that ran out of staging memory
+        stagingRingTail = batch->ringEnd;
+        stagingRingUsed -= batch->ringSize;
+        DestroyUploadBatchStagingBuffers(batch);
+
+        transferredUploadBatches.push_back(batch);
+        return true;
+    }
+    static void SubmitAcquireUploadBatches() {
+        // Submit the acquire barriers of every transferred batch, in transfer order
+        for(auto* batch : transferredUploadBatches) {
+            if(!batch->acquireBarriers.size()) {
+                freeUploadBatches.push_back(batch);
+                completedUpload = batch->upload;
+                continue;
+            }
+
+            // Set the begin info
+            VkCommandBufferBeginInfo beginInfo;
+
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.pNext = nullptr;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            beginInfo.pInheritanceInfo = nullptr;
+
+            // Record the barriers that acquire the images' ownership on the graphics queue
+            auto result = vkBeginCommandBuffer(batch->acquireCommandBuffer, &beginInfo);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to begin recording command buffer! Error code: " + VkResultToString(result), 1);
+            
+            vkCmdPipelineBarrier(batch->acquireCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT, 0, 0, nullptr, 0, nullptr, (uint32_t)batch->acquireBarriers.size(), batch->acquireBarriers.data());
+
+            // Submit the barriers; every frame submitted after them is ordered after them
+            SubmitUploadBatch(batch, batch->acquireCommandBuffer, graphicsQueue);
+            acquireUploadBatches.push_back(batch);
+
+            completedUpload = batch->upload;
+        }
+
+        transferredUploadBatches.clear();
+    }
+    static void UpdateAcquireUploadBatches() {
+        // Recycle every batch whose acquire barriers finished executing
+        for(size_t i = 0; i < acquireUploadBatches.size();) {
+            if(vkGetFenceStatus(device, acquireUploadBatches[i]->fence) != VK_SUCCESS) {
+                ++i;
+                continue;
+            }
+
+            freeUploadBatches.push_back(acquireUploadBatches[i]);
+            acquireUploadBatches[i] = acquireUploadBatches.back();
+            acquireUploadBatches.pop_back();
+        }
+    }
+    static VkDeviceSize AllocateStagingMemory(VkDeviceSize size) {
+        // Reset the ring if it's empty, so the whole ring is contiguous
+        if(!stagingRingUsed) {
+            stagingRingHead = 0;
+            stagingRingTail = 0;
+        }
+
+        while(true) {
+            // Check the free space after the head; if the head is behind the tail, the ring is only free up to the tail
+            VkDeviceSize endSpace = (stagingRingHead > stagingRingTail || !stagingRingUsed) ? STAGING_RING_SIZE - stagingRingHead : stagingRingTail - stagingRingHead;
+            if(size <= endSpace)
+                break;
+            
+            // Wrap around to the start of the ring, skipping the end, if the allocation fits before the tail
+            if(stagingRingHead > stagingRingTail && size <= stagingRingTail) {
+                stagingRingUsed += STAGING_RING_SIZE - stagingRingHead;
+                currentUploadBatch->ringSize += STAGING_RING_SIZE - stagingRingHead;
+                stagingRingHead = 0;
+                break;
+            }
+
+            // Wait for the oldest batch to free its memory, submitting the current batch first if it's the only one using the ring
+            if(transferUploadBatches.empty()) {
+                SubmitCurrentUploadBatch();
+                BeginUploadBatch();
+            }
+            UpdateTransferUploadBatches(true);
+
+            if(!stagingRingUsed) {
+                stagingRingHead = 0;
+                stagingRingTail = 0;
+            }
+        }
+
+        // Allocate the memory
+        VkDeviceSize offset = stagingRingHead;
+
+        stagingRingHead += size;
+        stagingRingUsed += size;
+        currentUploadBatch->ringSize += size;
+
+        return offset;
+    }
+    static void QueueDeletion(VkObjectType type, uint64_t handle, VkDescriptorPool descriptorPool = VK_NULL_HANDLE, const MemoryAllocation* allocation = nullptr) {
+        // Exit the function if there is nothing to delete
+        if(!handle)
+            return;
+        
+        // Set the deletion's info; its frame is set once the next frame is acquired
+        DeferredDeletion deletion{};
+
+        deletion.type = type;
+        deletion.handle = handle;
+        deletion.descriptorPool = descriptorPool;
+        if(allocation)
+            deletion.allocation = *allocation;
+
+        std::lock_guard<std::mutex> lock(deferredDeletionMutex);
+        queuedDeletions.push_back(deletion);
+    }
+    static void DestroyDeferredResource(DeferredDeletion& deletion) {
+        switch(deletion.type) {
+        case VK_OBJECT_TYPE_BUFFER:
+            vkDestroyBuffer(device, (VkBuffer)deletion.handle, allocator);
+            break;
+        case VK_OBJECT_TYPE_IMAGE:
+            vkDestroyImage(device, (VkImage)deletion.handle, allocator);
+            break;
+        case VK_OBJECT_TYPE_IMAGE_VIEW:
+            vkDestroyImageView(device, (VkImageView)deletion.handle, allocator);
+            break;
+        case VK_OBJECT_TYPE_DEVICE_MEMORY:
+            // Memory carved out by the memory allocator is returned to it, otherwise it's freed directly
+            if(deletion.allocation.memory)
+                FreeMemory(deletion.allocation);
+            else
+                vkFreeMemory(device, (VkDeviceMemory)deletion.handle, allocator);
+            break;
+        case VK_OBJECT_TYPE_DESCRIPTOR_SET: {
+            VkDescriptorSet descriptorSet = (VkDescriptorSet)deletion.handle;
+            auto result = vkFreeDescriptorSets(device, deletion.descriptorPool, 1, &descriptorSet);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to free descriptor set! Error code: " + VkResultToString(result), 1);
+            break;
+        }
+        case VK_OBJECT_TYPE_PIPELINE:
+            vkDestroyPipeline(device, (VkPipeline)deletion.handle, allocator);
+            break;
+        default:
+            break;
+        }
+    }
+    static void DestroyDeferredResources(bool8_t destroyAll) {
+        std::lock_guard<std::mutex> lock(deferredDeletionMutex);
+
+        // Tag the newly queued deletions with the last submitted frame, which is the last frame that could have used them
+        uint64_t submittedFrame = destroyAll ? 0 : GetSubmittedFrameValue();
+        for(auto& deletion : queuedDeletions) {
+            deletion.frame = submittedFrame;
+            deferredDeletions.push_back(deletion);
+        }
+        queuedDeletions.clear();
+
+        for(size_t i = 0; i < deferredDeletions.size();) {
+            // Skip the deletion if its frame is still in flight
+            if(!destroyAll && !HasGPUReachedFrame(deferredDeletions[i].frame)) {
+                ++i;
+                continue;
+            }
+
+            DestroyDeferredResource(deferredDeletions[i]);
+
+            // Remove the deletion from the list
+            deferredDeletions[i] = deferredDeletions.back();
+            deferredDeletions.pop_back();
+        }
+    }
+
     // Public functions
     void CreateDevice() {
+        // Route Vulkan's host memory through the tracking allocator, unless it was disabled
+        allocator = GetHostAllocationCallbacks();
+
         CreateInstance();
         SetupDebugMessenger();
         CreateSurface();
         PickPhysicalDevice();
         CreateLogicalDevice();
         CreateCommandPool();
+        CreatePipelineCache();
+        CreateMemoryAllocator();
+        CreateUploadService();
     }
     void DeleteDevice() {
+        // Every frame finished by now, so destroy every deferred resource
+        WaitForDeviceIdle();
+        DestroyDeferredResources(true);
+
+        DeleteUploadService();
+        SavePipelineCache();
+        vkDestroyPipelineCache(device, pipelineCache, allocator);
+        DeleteThreadCommandPools();
         vkDestroyCommandPool(device, commandPool, allocator);
+        DeleteMemoryAllocator();
         vkDestroyDevice(device, allocator);
-        vkDestroySurfaceKHR(instance, surface, allocator);
+        if(surface)
+            vkDestroySurfaceKHR(instance, surface, allocator);
         DestroyDebugUtilsMessengerEXT(instance, debugMessenger, allocator);
         vkDestroyInstance(instance, allocator);
 
@@ -476,12 +1312,50 @@ namespace wfe::editor {
     VkQueue GetPresentQueue() {
         return presentQueue;
     }
+    VkQueue GetTransferQueue() {
+        return transferQueue;
+    }
+    VkResult SubmitToQueue(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        return vkQueueSubmit(queue, submitCount, submits, fence);
+    }
+    VkResult PresentToQueue(const VkPresentInfoKHR& presentInfo) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        return vkQueuePresentKHR(presentQueue, &presentInfo);
+    }
+    void WaitForQueueIdle(VkQueue queue) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        vkQueueWaitIdle(queue);
+    }
+    void WaitForDeviceIdle() {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        vkDeviceWaitIdle(device);
+    }
+    VkPipelineCache GetPipelineCache() {
+        return pipelineCache;
+    }
     const VkPhysicalDeviceProperties& GetPhysicalDeviceProperties() {
         return physicalDeviceProperties;
     }
     const VkPhysicalDeviceFeatures& GetPhysicalDeviceFeatures() {
         return physicalDeviceFeatures;
     }
+    const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& GetDescriptorIndexingFeatures() {
+        return descriptorIndexingFeatures;
+    }
+    bool8_t IsDynamicRenderingSupported() {
+        return dynamicRenderingFeatures.dynamicRendering;
+    }
+    bool8_t IsTimelineSemaphoreSupported() {
+        return timelineSemaphoreFeatures.timelineSemaphore;
+    }
+    bool8_t IsDeviceExtensionEnabled(const char_t* extensionName) {
+        for(const auto* extension : enabledDeviceExtensions)
+            if(!strcmp(extension, extensionName))
+                return true;
+        
+        return false;
+    }
     bool8_t AreValidationLayersEnabled() {
         return enableValidationLayers;
     }
@@ -568,6 +1442,35 @@ namespace wfe::editor {
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to bind buffer memory! Error code: " + VkResultToString(result), 1);
     }
+    void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, MemoryAllocation& bufferAllocation) {
+        // Set the buffer create info
+        VkBufferCreateInfo bufferCreateInfo;
+
+        bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferCreateInfo.pNext = nullptr;
+        bufferCreateInfo.flags = 0;
+        bufferCreateInfo.size = size;
+        bufferCreateInfo.usage = usage;
+        bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        bufferCreateInfo.queueFamilyIndexCount = 0;
+        bufferCreateInfo.pQueueFamilyIndices = nullptr;
+
+        // Create the buffer
+        auto result = vkCreateBuffer(device, &bufferCreateInfo, allocator, &buffer);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create buffer! Error code: " + VkResultToString(result), 1);
+
+        // Get the buffer's memory requirements and allocate its memory
+        VkMemoryRequirements memoryRequirements;
+        vkGetBufferMemoryRequirements(device, buffer, &memoryRequirements);
+
+        AllocateMemory(memoryRequirements, properties, true, bufferAllocation);
+        
+        // Bind the buffer's memory
+        result = vkBindBufferMemory(device, buffer, bufferAllocation.memory, bufferAllocation.offset);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to bind buffer memory! Error code: " + VkResultToString(result), 1);
+    }
     void CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) {
         // Create the image
         auto result = vkCreateImage(device, &imageInfo, allocator, &image);
@@ -596,22 +1499,81 @@ namespace wfe::editor {
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to bind image memory! Error code: " + VkResultToString(result), 1);
     }
-    VkCommandBuffer BeginSingleTimeCommands() {
+    void CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image, MemoryAllocation& imageAllocation) {
+        // Create the image
+        auto result = vkCreateImage(device, &imageInfo, allocator, &image);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create image! Error code: " + VkResultToString(result), 1);
+        
+        // Get the image's memory requirements and allocate its memory
+        VkMemoryRequirements memoryRequirements;
+        vkGetImageMemoryRequirements(device, image, &memoryRequirements);
+
+        AllocateMemory(memoryRequirements, properties, imageInfo.tiling == VK_IMAGE_TILING_LINEAR, imageAllocation);
+        
+        // Bind the image's memory
+        result = vkBindImageMemory(device, image, imageAllocation.memory, imageAllocation.offset);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to bind image memory! Error code: " + VkResultToString(result), 1);
+    }
+    VkCommandBuffer AllocateFrameCommandBuffer(uint32_t frameIndex) {
+        ThreadCommandPools* pools = GetThreadCommandPools();
+        std::lock_guard<std::mutex> poolLock(pools->mutex);
+
+        // Recycle a command buffer left over from the last time the pool was reset, if one is available
+        size_t& usedCount = pools->usedCommandBufferCounts[frameIndex];
+        vector<VkCommandBuffer>& commandBuffers = pools->commandBuffers[frameIndex];
+
+        if(usedCount < commandBuffers.size())
+            return commandBuffers[usedCount++];
+
         // Set the command buffer allocate info
         VkCommandBufferAllocateInfo allocateInfo;
 
         allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocateInfo.pNext = nullptr;
-        allocateInfo.commandPool = commandPool;
+        allocateInfo.commandPool = pools->commandPools[frameIndex];
         allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         allocateInfo.commandBufferCount = 1;
 
-        // Allocate the command buffer
+        // Allocate a new command buffer, which will be recycled from now on
         VkCommandBuffer commandBuffer;
         auto result = vkAllocateCommandBuffers(device, &allocateInfo, &commandBuffer);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to allocate command buffer! Error code: " + VkResultToString(result), 1);
         
+        commandBuffers.push_back(commandBuffer);
+        ++usedCount;
+
+        return commandBuffer;
+    }
+    void ResetFrameCommandPools(uint32_t frameIndex) {
+        std::lock_guard<std::mutex> lock(threadCommandPoolsMutex);
+
+        // Reset the frame's command pool of every thread
+        for(auto* pools : threadCommandPools) {
+            std::lock_guard<std::mutex> poolLock(pools->mutex);
+
+            auto result = vkResetCommandPool(device, pools->commandPools[frameIndex], 0);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to reset frame command pool! Error code: " + VkResultToString(result), 1);
+            pools->usedCommandBufferCounts[frameIndex] = 0;
+        }
+    }
+    VkCommandBuffer BeginCommandBatch() {
+        ThreadCommandPools* pools = GetThreadCommandPools();
+
+        // Get a free batch from the calling thread's command batch pool
+        VkCommandBuffer commandBuffer;
+        {
+            std::lock_guard<std::mutex> lock(commandBatchMutex);
+
+            CommandBatch* commandBatch = GetFreeCommandBatch(pools);
+            commandBatch->batch = 0;
+            commandBatch->recording = true;
+            commandBuffer = commandBatch->commandBuffer;
+        }
+        
         // Set the begin info
         VkCommandBufferBeginInfo beginInfo;
 
@@ -621,17 +1583,36 @@ namespace wfe::editor {
         beginInfo.pInheritanceInfo = nullptr;
 
         // Begin recording the command buffer
-        result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
+        auto result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to begin recording command buffer! Error code: " + VkResultToString(result), 1);
         
         return commandBuffer;
     }
-    void EndSingleTimeCommands(VkCommandBuffer commandBuffer) {
+    uint64_t SubmitCommandBatch(VkCommandBuffer commandBuffer) {
         // End recording the command buffer
         auto result = vkEndCommandBuffer(commandBuffer);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to end recording command buffer! Error code: " + VkResultToString(result), 1);
+        
+        std::lock_guard<std::mutex> lock(commandBatchMutex);
+
+        // Find the batch the command buffer belongs to
+        CommandBatch* commandBatch = nullptr;
+        for(auto* batch : commandBatches) {
+            if(batch->commandBuffer == commandBuffer && batch->recording) {
+                commandBatch = batch;
+                break;
+            }
+        }
+
+        if(!commandBatch)
+            console::OutFatalError("Tried to submit a command buffer that wasn't returned by BeginCommandBatch!", 1);
+        
+        // Reset the batch's fence, which is still signaled if the batch was recycled
+        result = vkResetFences(device, 1, &commandBatch->fence);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to reset fence! Error code: " + VkResultToString(result), 1);
 
         // Set the command buffer submit info
         VkSubmitInfo submitInfo;
@@ -647,15 +1628,206 @@ namespace wfe::editor {
         submitInfo.pSignalSemaphores = nullptr;
 
         // Submit the command buffer
-        result = vkQueueSubmit(graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
+        result = SubmitToQueue(graphicsQueue, 1, &submitInfo, commandBatch->fence);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to submit to queue! Error code: " + VkResultToString(result), 1);
         
-        // Wait for the queue to idle
-        vkQueueWaitIdle(graphicsQueue);
+        commandBatch->batch = nextCommandBatch++;
+        commandBatch->recording = false;
+
+        return commandBatch->batch;
+    }
+    bool8_t IsCommandBatchComplete(uint64_t batch) {
+        std::lock_guard<std::mutex> lock(commandBatchMutex);
+
+        // Batches are only recycled once they complete, so a batch that can't be found already completed
+        CommandBatch* commandBatch = FindCommandBatch(batch);
+        if(!commandBatch)
+            return batch < nextCommandBatch;
+        
+        return vkGetFenceStatus(device, commandBatch->fence) == VK_SUCCESS;
+    }
+    void WaitForCommandBatch(uint64_t batch) {
+        // Find the batch, keeping it from being recycled while it's waited on
+        CommandBatch* commandBatch;
+        {
+            std::lock_guard<std::mutex> lock(commandBatchMutex);
+
+            // Exit the function if the batch already completed and was recycled
+            commandBatch = FindCommandBatch(batch);
+            if(!commandBatch)
+                return;
+            
+            ++commandBatch->waiterCount;
+        }
+
+        // Wait for the batch's fence without holding the lock, so other threads can keep submitting batches
+        auto result = vkWaitForFences(device, 1, &commandBatch->fence, VK_TRUE, UINT64_MAX);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to wait for fence! Error code: " + VkResultToString(result), 1);
+        
+        std::lock_guard<std::mutex> lock(commandBatchMutex);
+        --commandBatch->waiterCount;
+    }
+    VkCommandBuffer BeginSingleTimeCommands() {
+        return BeginCommandBatch();
+    }
+    void EndSingleTimeCommands(VkCommandBuffer commandBuffer) {
+        WaitForCommandBatch(SubmitCommandBatch(commandBuffer));
+    }
+    uint64_t UploadImageData(VkImage image, uint32_t width, uint32_t height, const void* data, VkDeviceSize size) {
+        std::lock_guard<std::mutex> lock(uploadMutex);
+
+        BeginUploadBatch();
+
+        // Get the staging memory; uploads that could never fit in the ring get their own staging buffer
+        VkBuffer stagingBuffer;
+        VkDeviceSize stagingOffset;
+        VkDeviceSize alignedSize = (size + stagingRingAlignment - 1) & ~(stagingRingAlignment - 1);
+
+        if(alignedSize <= STAGING_RING_SIZE) {
+            stagingOffset = AllocateStagingMemory(alignedSize);
+            stagingBuffer = stagingRingBuffer;
+
+            memcpy(stagingRingMappedMemory + stagingOffset, data, (size_t)size);
+
+            // Flush the written range
+            FlushMemory(stagingRingAllocation, stagingOffset, alignedSize);
+        } else {
+            MemoryAllocation stagingBufferAllocation;
+            CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, stagingBuffer, stagingBufferAllocation);
+
+            memcpy(stagingBufferAllocation.mappedMemory, data, (size_t)size);
+
+            // Flush the whole buffer
+            FlushMemory(stagingBufferAllocation);
+
+            stagingOffset = 0;
+            currentUploadBatch->stagingBuffers.push_back(stagingBuffer);
+            currentUploadBatch->stagingBufferAllocations.push_back(stagingBufferAllocation);
+        }
+
+        VkCommandBuffer commandBuffer = currentUploadBatch->transferCommandBuffer;
+
+        // Set the image memory barrier
+        VkImageMemoryBarrier barrier;
+
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext = nullptr;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+
+        // Transition the image to the transfer destination layout
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        // Set the copy region
+        VkBufferImageCopy region;
+        region.bufferOffset = stagingOffset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+
+        region.imageOffset = { 0, 0, 0 };
+        region.imageExtent = { width, height, 1 };
+
+        // Copy the staging memory to the image
+        vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        // Transition the image to the shader read only layout. If the transfer queue family is separate, this releases
+        // the image's ownership and a matching barrier acquires it on the graphics queue once the transfer is done
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        if(queueFamilyIndices.transferFamily != queueFamilyIndices.graphicsFamily) {
+            barrier.dstAccessMask = 0;
+            barrier.srcQueueFamilyIndex = queueFamilyIndices.transferFamily;
+            barrier.dstQueueFamilyIndex = queueFamilyIndices.graphicsFamily;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            currentUploadBatch->acquireBarriers.push_back(barrier);
+        } else {
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        }
 
-        // Free the command buffer
-        vkFreeCommandBuffers(device, commandPool, 1, &commandBuffer);
+        return currentUploadBatch->upload;
+    }
+    void SubmitUploads() {
+        std::lock_guard<std::mutex> lock(uploadMutex);
+
+        SubmitCurrentUploadBatch();
+
+        // Check which batches finished, without waiting, and acquire their images on the graphics queue
+        while(UpdateTransferUploadBatches(false));
+        SubmitAcquireUploadBatches();
+        UpdateAcquireUploadBatches();
+    }
+    bool8_t IsUploadComplete(uint64_t upload) {
+        std::lock_guard<std::mutex> lock(uploadMutex);
+        return upload <= completedUpload;
+    }
+    void WaitForUpload(uint64_t upload) {
+        std::lock_guard<std::mutex> lock(uploadMutex);
+
+        // Submit the upload if it's still being recorded
+        if(currentUploadBatch && currentUploadBatch->upload <= upload)
+            SubmitCurrentUploadBatch();
+        
+        // Wait for batches to finish until the upload is complete, acquiring their images on the graphics queue
+        SubmitAcquireUploadBatches();
+        while(completedUpload < upload && UpdateTransferUploadBatches(true))
+            SubmitAcquireUploadBatches();
+    }
+    bool8_t HasPendingUploads() {
+        std::lock_guard<std::mutex> lock(uploadMutex);
+        return currentUploadBatch || transferUploadBatches.size() || transferredUploadBatches.size();
+    }
+    void DeferDestroyBuffer(VkBuffer buffer) {
+        QueueDeletion(VK_OBJECT_TYPE_BUFFER, (uint64_t)buffer);
+    }
+    void DeferDestroyImage(VkImage image) {
+        QueueDeletion(VK_OBJECT_TYPE_IMAGE, (uint64_t)image);
+    }
+    void DeferDestroyImageView(VkImageView imageView) {
+        QueueDeletion(VK_OBJECT_TYPE_IMAGE_VIEW, (uint64_t)imageView);
+    }
+    void DeferFreeMemory(VkDeviceMemory memory) {
+        QueueDeletion(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)memory);
+    }
+    void DeferFreeMemory(const MemoryAllocation& allocation) {
+        QueueDeletion(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)allocation.memory, VK_NULL_HANDLE, &allocation);
+    }
+    void DeferFreeDescriptorSet(VkDescriptorPool descriptorPool, VkDescriptorSet descriptorSet) {
+        QueueDeletion(VK_OBJECT_TYPE_DESCRIPTOR_SET, (uint64_t)descriptorSet, descriptorPool);
+    }
+    void DeferDestroyPipeline(VkPipeline pipeline) {
+        QueueDeletion(VK_OBJECT_TYPE_PIPELINE, (uint64_t)pipeline);
+    }
+    void DestroyDeferredResources() {
+        DestroyDeferredResources(false);
+    }
+    size_t GetDeferredDeletionCount() {
+        std::lock_guard<std::mutex> lock(deferredDeletionMutex);
+        return queuedDeletions.size() + deferredDeletions.size();
     }
     void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkCommandBuffer commandBuffer) {
         // Begin single time commands if the command buffer's not set
@@ -0,0 +1,198 @@
+#include "Vulkan/GPUTimings.hpp"
+#include "Vulkan/Device.hpp"
+#include "Vulkan/SwapChain.hpp"
+
+namespace wfe::editor {
+    struct GPUTimingScope {
+        string name;
+        uint32_t beginQuery, endQuery;
+        uint32_t depth;
+    };
+    struct GPUTimingFrame {
+        VkQueryPool queryPool;
+        uint32_t queryCount;
+        vector<GPUTimingScope> scopes;
+        bool8_t recorded;
+    };
+
+    // Constants
+    const uint32_t MAX_GPU_TIMING_QUERIES = 512;
+
+    // Variables
+    bool8_t gpuTimingsSupported = false;
+    bool8_t windowGPUTimings = false;
+    uint64_t timestampMask;
+    float64_t timestampPeriod;
+
+    GPUTimingFrame timingFrames[MAX_FRAMES_IN_FLIGHT];
+    GPUTimingFrame* currentTimingFrame = nullptr;
+    uint32_t currentScopeDepth = 0;
+    uint32_t frameScope;
+
+    vector<GPUTiming> gpuTimings;
+    vector<uint64_t> timestamps;
+
+    // Internal helper functions
+    static void ReadGPUTimingResults(GPUTimingFrame& timingFrame) {
+        // Exit the function if the frame has no results
+        if(!timingFrame.recorded || !timingFrame.queryCount)
+            return;
+        
+        // Get the results without waiting; the frame's fence was already waited on, so they should be available
+        auto result = vkGetQueryPoolResults(GetDevice(), timingFrame.queryPool, 0, timingFrame.queryCount, timingFrame.queryCount * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+        if(result == VK_NOT_READY)
+            return;
+        if(result != VK_SUCCESS) {
+            console::OutWarningFunction((string)"Failed to get GPU timing query results! Error code: " + VkResultToString(result));
+            return;
+        }
+
+        // Convert every scope's timestamps to milliseconds
+        gpuTimings.resize(timingFrame.scopes.size());
+        for(size_t i = 0; i < timingFrame.scopes.size(); ++i) {
+            const GPUTimingScope& scope = timingFrame.scopes[i];
+            uint64_t ticks = scope.endQuery == INVALID_GPU_SCOPE ? 0 : ((timestamps[scope.endQuery] - timestamps[scope.beginQuery]) & timestampMask);
+
+            gpuTimings[i].name = scope.name;
+            gpuTimings[i].duration = (float64_t)ticks * timestampPeriod * 1e-6;
+            gpuTimings[i].depth = scope.depth;
+        }
+    }
+
+    // Public functions
+    void CreateGPUTimings() {
+        // Check if the graphics queue family supports timestamps
+        uint32_t queueFamilyCount;
+        vkGetPhysicalDeviceQueueFamilyProperties(GetPhysicalDevice(), &queueFamilyCount, nullptr);
+        vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(GetPhysicalDevice(), &queueFamilyCount, queueFamilies.data());
+
+        uint32_t validBits = queueFamilies[FindPhysicalQueueFamilies().graphicsFamily].timestampValidBits;
+        if(!validBits) {
+            console::OutWarningFunction("The graphics queue doesn't support timestamps; GPU timings are disabled.");
+            return;
+        }
+
+        gpuTimingsSupported = true;
+        timestampMask = validBits >= 64 ? UINT64_MAX : (((uint64_t)1 << validBits) - 1);
+        timestampPeriod = (float64_t)GetPhysicalDeviceProperties().limits.timestampPeriod;
+        timestamps.resize(MAX_GPU_TIMING_QUERIES);
+
+        // Set the query pool create info
+        VkQueryPoolCreateInfo createInfo;
+
+        createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        createInfo.queryCount = MAX_GPU_TIMING_QUERIES;
+        createInfo.pipelineStatistics = 0;
+
+        // Create a query pool for every frame in flight
+        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
+            auto result = vkCreateQueryPool(GetDevice(), &createInfo, GetVulkanAllocator(), &timingFrames[i].queryPool);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to create query pool! Error code: " + VkResultToString(result), 1);
+            
+            timingFrames[i].queryCount = 0;
+            timingFrames[i].recorded = false;
+        }
+
+        console::OutMessageFunction("Created GPU timing query pools successfully.");
+    }
+    void DeleteGPUTimings() {
+        // Exit the function if no query pools were created
+        if(!gpuTimingsSupported)
+            return;
+        
+        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
+            vkDestroyQueryPool(GetDevice(), timingFrames[i].queryPool, GetVulkanAllocator());
+            timingFrames[i].scopes.clear();
+        }
+
+        gpuTimings.clear();
+        gpuTimingsSupported = false;
+
+        console::OutMessageFunction("Deleted GPU timing query pools successfully.");
+    }
+
+    bool8_t AreGPUTimingsSupported() {
+        return gpuTimingsSupported;
+    }
+    bool8_t AreWindowGPUTimingsEnabled() {
+        return windowGPUTimings;
+    }
+    void EnableWindowGPUTimings() {
+        windowGPUTimings = true;
+    }
+    void DisableWindowGPUTimings() {
+        windowGPUTimings = false;
+    }
+
+    void BeginGPUTimingFrame(VkCommandBuffer commandBuffer) {
+        // Exit the function if timestamps aren't supported
+        if(!gpuTimingsSupported)
+            return;
+        
+        // Read the results written the last time this frame in flight was used, which finished once its fence was waited on
+        GPUTimingFrame& timingFrame = timingFrames[GetCurrentFrame()];
+        ReadGPUTimingResults(timingFrame);
+
+        // Reset the frame's queries and start timing the frame
+        vkCmdResetQueryPool(commandBuffer, timingFrame.queryPool, 0, MAX_GPU_TIMING_QUERIES);
+
+        timingFrame.queryCount = 0;
+        timingFrame.scopes.clear();
+        timingFrame.recorded = true;
+
+        currentTimingFrame = &timingFrame;
+        currentScopeDepth = 0;
+
+        frameScope = BeginGPUScope(commandBuffer, "ImGui render pass");
+    }
+    void EndGPUTimingFrame(VkCommandBuffer commandBuffer) {
+        // Exit the function if no frame is being timed
+        if(!currentTimingFrame)
+            return;
+        
+        EndGPUScope(commandBuffer, frameScope);
+        currentTimingFrame = nullptr;
+    }
+
+    uint32_t BeginGPUScope(VkCommandBuffer commandBuffer, const char_t* name) {
+        // Exit the function if no frame is being timed or if the frame's queries ran out, keeping an end query for every open scope
+        if(!currentTimingFrame || currentTimingFrame->queryCount + currentScopeDepth + 2 > MAX_GPU_TIMING_QUERIES)
+            return INVALID_GPU_SCOPE;
+        
+        // Add the scope and write its start timestamp; its end query is reserved once it ends
+        GPUTimingScope scope;
+
+        scope.name = name;
+        scope.beginQuery = currentTimingFrame->queryCount++;
+        scope.endQuery = INVALID_GPU_SCOPE;
+        scope.depth = currentScopeDepth++;
+
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, currentTimingFrame->queryPool, scope.beginQuery);
+
+        currentTimingFrame->scopes.push_back(scope);
+        return (uint32_t)(currentTimingFrame->scopes.size() - 1);
+    }
+    void EndGPUScope(VkCommandBuffer commandBuffer, uint32_t scope) {
+        // Exit the function if the scope is invalid
+        if(!currentTimingFrame || scope == INVALID_GPU_SCOPE || scope >= currentTimingFrame->scopes.size())
+            return;
+        
+        // Write the scope's end timestamp once every previous command finished
+        GPUTimingScope& timingScope = currentTimingFrame->scopes[scope];
+        timingScope.endQuery = currentTimingFrame->queryCount++;
+
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, currentTimingFrame->queryPool, timingScope.endQuery);
+
+        if(currentScopeDepth)
+            --currentScopeDepth;
+    }
+
+    const vector<GPUTiming>& GetGPUTimings() {
+        return gpuTimings;
+    }
+}
@@ -0,0 +1,288 @@
+#include "Vulkan/HostAllocator.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+
+namespace wfe::editor {
+    // Constants
+    const size_t ARENA_CHUNK_SIZE = 65536;             // The size of every command scope arena chunk
+    const size_t MAX_ARENA_ALLOCATION_SIZE = 16384;    // Larger command scope allocations, including their alignment, skip the arena
+    const size_t MIN_HOST_ALLOCATION_ALIGNMENT = 16;   // The smallest alignment of every allocation, which keeps the allocation headers aligned
+
+    // Structs
+    struct ArenaChunk {
+        uint8_t* memory;
+        size_t head;
+        std::atomic<size_t> refCount; // The number of live allocations, plus one while the chunk is its thread's current chunk
+    };
+    struct HostAllocationHeader {
+        size_t size;
+        void* base;         // The pointer returned by malloc, or nullptr if the allocation lives in an arena chunk
+        ArenaChunk* chunk;  // The arena chunk the allocation lives in, or nullptr if it was allocated with malloc
+        uint32_t scope;
+        uint32_t padding;
+    };
+    struct HostScopeCounters {
+        std::atomic<size_t> liveSize;
+        std::atomic<size_t> peakSize;
+        std::atomic<size_t> liveCount;
+        std::atomic<size_t> allocationCount;
+        std::atomic<size_t> internalSize;
+    };
+    struct ThreadArena {
+        ArenaChunk* chunk = nullptr;
+
+        ~ThreadArena();
+    };
+
+    // Variables
+    bool8_t hostAllocatorEnabled = true;
+    VkAllocationCallbacks hostAllocationCallbacks;
+
+    HostScopeCounters hostScopeCounters[HOST_ALLOCATION_SCOPE_COUNT];
+    std::atomic<size_t> commandAllocationSize{ 0 };
+    std::atomic<size_t> arenaChunkCount{ 0 };
+
+    std::mutex hostFrameStatsMutex;
+    size_t hostFrameMarkCount = 0;
+    size_t firstMarkCommandCount = 0, firstMarkCommandSize = 0;
+    size_t lastMarkCommandCount = 0, lastMarkCommandSize = 0;
+    size_t lastFrameCommandCount = 0, lastFrameCommandSize = 0;
+
+    thread_local ThreadArena threadArena;
+
+    // Internal helper functions
+    static uint8_t* AlignPointer(uint8_t* pointer, size_t alignment) {
+        return (uint8_t*)(((uintptr_t)pointer + alignment - 1) & ~(uintptr_t)(alignment - 1));
+    }
+    static HostAllocationHeader* GetAllocationHeader(void* memory) {
+        return (HostAllocationHeader*)memory - 1;
+    }
+
+    static ArenaChunk* CreateArenaChunk() {
+        ArenaChunk* chunk = new ArenaChunk();
+        chunk->memory = (uint8_t*)malloc(ARENA_CHUNK_SIZE);
+        chunk->head = 0;
+        chunk->refCount.store(1, std::memory_order_relaxed);
+
+        arenaChunkCount.fetch_add(1, std::memory_order_relaxed);
+        return chunk;
+    }
+    static void ReleaseArenaChunk(ArenaChunk* chunk) {
+        // Free the chunk once its thread moved on from it and every allocation in it was freed
+        if(chunk->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        free(chunk->memory);
+        delete chunk;
+
+        arenaChunkCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    ThreadArena::~ThreadArena() {
+        if(chunk)
+            ReleaseArenaChunk(chunk);
+    }
+
+    static void* AllocateFromArena(size_t size, size_t alignment, ArenaChunk*& allocationChunk) {
+        ArenaChunk*& chunk = threadArena.chunk;
+        if(!chunk)
+            chunk = CreateArenaChunk();
+
+        uint8_t* memory = AlignPointer(chunk->memory + chunk->head + sizeof(HostAllocationHeader), alignment);
+        if(memory + size > chunk->memory + ARENA_CHUNK_SIZE) {
+            // Rewind the chunk if every allocation in it was freed, which is usually the case, since command scope allocations
+            // only live for a single call; otherwise move on to a new chunk, leaving the old one to the allocations still in it
+            if(chunk->refCount.load(std::memory_order_acquire) == 1)
+                chunk->head = 0;
+            else {
+                ReleaseArenaChunk(chunk);
+                chunk = CreateArenaChunk();
+            }
+
+            memory = AlignPointer(chunk->memory + sizeof(HostAllocationHeader), alignment);
+        }
+
+        chunk->head = (size_t)(memory + size - chunk->memory);
+        chunk->refCount.fetch_add(1, std::memory_order_relaxed);
+
+        allocationChunk = chunk;
+        return memory;
+    }
+    static void TrackAllocation(size_t size, uint32_t scope) {
+        HostScopeCounters& counters = hostScopeCounters[scope];
+
+        // Raise the peak size if the live size went over it
+        size_t liveSize = counters.liveSize.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t peakSize = counters.peakSize.load(std::memory_order_relaxed);
+        while(liveSize > peakSize && !counters.peakSize.compare_exchange_weak(peakSize, liveSize, std::memory_order_relaxed));
+
+        counters.liveCount.fetch_add(1, std::memory_order_relaxed);
+        counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        if(scope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND)
+            commandAllocationSize.fetch_add(size, std::memory_order_relaxed);
+    }
+    static void TrackFree(size_t size, uint32_t scope) {
+        HostScopeCounters& counters = hostScopeCounters[scope];
+
+        counters.liveSize.fetch_sub(size, std::memory_order_relaxed);
+        counters.liveCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    static VKAPI_ATTR void* VKAPI_CALL HostAllocate(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope allocationScope) {
+        if(alignment < MIN_HOST_ALLOCATION_ALIGNMENT)
+            alignment = MIN_HOST_ALLOCATION_ALIGNMENT;
+
+        // Allocate the memory, with room for the header before it
+        uint8_t* memory;
+        void* base = nullptr;
+        ArenaChunk* chunk = nullptr;
+
+        if(allocationScope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND && size + alignment <= MAX_ARENA_ALLOCATION_SIZE)
+            memory = (uint8_t*)AllocateFromArena(size, alignment, chunk);
+        else {
+            base = malloc(size + alignment + sizeof(HostAllocationHeader));
+            if(!base)
+                return nullptr;
+
+            memory = AlignPointer((uint8_t*)base + sizeof(HostAllocationHeader), alignment);
+        }
+
+        // Fill in the header
+        HostAllocationHeader* header = GetAllocationHeader(memory);
+
+        header->size = size;
+        header->base = base;
+        header->chunk = chunk;
+        header->scope = (uint32_t)allocationScope;
+
+        TrackAllocation(size, header->scope);
+
+        return memory;
+    }
+    static VKAPI_ATTR void VKAPI_CALL HostFree(void* pUserData, void* pMemory) {
+        // Vulkan might free null pointers
+        if(!pMemory)
+            return;
+
+        HostAllocationHeader* header = GetAllocationHeader(pMemory);
+        TrackFree(header->size, header->scope);
+
+        if(header->chunk)
+            ReleaseArenaChunk(header->chunk);
+        else
+            free(header->base);
+    }
+    static VKAPI_ATTR void* VKAPI_CALL HostReallocate(void* pUserData, void* pOriginal, size_t size, size_t alignment, VkSystemAllocationScope allocationScope) {
+        // Reallocating a null pointer allocates new memory, while reallocating to a size of 0 frees the memory
+        if(!pOriginal)
+            return HostAllocate(pUserData, size, alignment, allocationScope);
+        if(!size) {
+            HostFree(pUserData, pOriginal);
+            return nullptr;
+        }
+
+        // Move the contents to a new allocation; the original memory must stay intact if the allocation fails
+        void* memory = HostAllocate(pUserData, size, alignment, allocationScope);
+        if(!memory)
+            return nullptr;
+
+        size_t originalSize = GetAllocationHeader(pOriginal)->size;
+        memcpy(memory, pOriginal, originalSize < size ? originalSize : size);
+
+        HostFree(pUserData, pOriginal);
+        return memory;
+    }
+    static VKAPI_ATTR void VKAPI_CALL HostInternalAllocationNotification(void* pUserData, size_t size, VkInternalAllocationType allocationType, VkSystemAllocationScope allocationScope) {
+        hostScopeCounters[allocationScope].internalSize.fetch_add(size, std::memory_order_relaxed);
+    }
+    static VKAPI_ATTR void VKAPI_CALL HostInternalFreeNotification(void* pUserData, size_t size, VkInternalAllocationType allocationType, VkSystemAllocationScope allocationScope) {
+        hostScopeCounters[allocationScope].internalSize.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    // Public functions
+    const VkAllocationCallbacks* GetHostAllocationCallbacks() {
+        if(!hostAllocatorEnabled)
+            return nullptr;
+
+        // Set the allocation callbacks
+        hostAllocationCallbacks.pUserData = nullptr;
+        hostAllocationCallbacks.pfnAllocation = HostAllocate;
+        hostAllocationCallbacks.pfnReallocation = HostReallocate;
+        hostAllocationCallbacks.pfnFree = HostFree;
+        hostAllocationCallbacks.pfnInternalAllocation = HostInternalAllocationNotification;
+        hostAllocationCallbacks.pfnInternalFree = HostInternalFreeNotification;
+
+        return &hostAllocationCallbacks;
+    }
+    bool8_t IsHostAllocatorEnabled() {
+        return hostAllocatorEnabled;
+    }
+    void DisableHostAllocator() {
+        hostAllocatorEnabled = false;
+    }
+    void MarkHostAllocatorFrame() {
+        size_t commandCount = hostScopeCounters[VK_SYSTEM_ALLOCATION_SCOPE_COMMAND].allocationCount.load(std::memory_order_relaxed);
+        size_t commandSize = commandAllocationSize.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(hostFrameStatsMutex);
+
+        // Count the allocations made since the last mark; the ones made before the first mark were made during startup
+        if(hostFrameMarkCount) {
+            lastFrameCommandCount = commandCount - lastMarkCommandCount;
+            lastFrameCommandSize = commandSize - lastMarkCommandSize;
+        } else {
+            firstMarkCommandCount = commandCount;
+            firstMarkCommandSize = commandSize;
+        }
+
+        lastMarkCommandCount = commandCount;
+        lastMarkCommandSize = commandSize;
+        ++hostFrameMarkCount;
+    }
+
+    HostAllocatorStats GetHostAllocatorStats() {
+        HostAllocatorStats stats;
+
+        for(size_t i = 0; i < HOST_ALLOCATION_SCOPE_COUNT; ++i) {
+            stats.scopes[i].liveSize = hostScopeCounters[i].liveSize.load(std::memory_order_relaxed);
+            stats.scopes[i].peakSize = hostScopeCounters[i].peakSize.load(std::memory_order_relaxed);
+            stats.scopes[i].liveCount = hostScopeCounters[i].liveCount.load(std::memory_order_relaxed);
+            stats.scopes[i].allocationCount = hostScopeCounters[i].allocationCount.load(std::memory_order_relaxed);
+            stats.scopes[i].internalSize = hostScopeCounters[i].internalSize.load(std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(hostFrameStatsMutex);
+
+            stats.frameCommandAllocationCount = lastFrameCommandCount;
+            stats.frameCommandAllocationSize = lastFrameCommandSize;
+
+            size_t frameCount = hostFrameMarkCount > 1 ? hostFrameMarkCount - 1 : 1;
+            stats.averageFrameCommandAllocationCount = (float64_t)(lastMarkCommandCount - firstMarkCommandCount) / frameCount;
+            stats.averageFrameCommandAllocationSize = (float64_t)(lastMarkCommandSize - firstMarkCommandSize) / frameCount;
+        }
+
+        stats.arenaChunkCount = arenaChunkCount.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+    const char_t* HostAllocationScopeToString(VkSystemAllocationScope scope) {
+        switch(scope) {
+        case VK_SYSTEM_ALLOCATION_SCOPE_COMMAND:
+            return "Command";
+        case VK_SYSTEM_ALLOCATION_SCOPE_OBJECT:
+            return "Object";
+        case VK_SYSTEM_ALLOCATION_SCOPE_CACHE:
+            return "Cache";
+        case VK_SYSTEM_ALLOCATION_SCOPE_DEVICE:
+            return "Device";
+        case VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE:
+            return "Instance";
+        default:
+            return "Unknown";
+        }
+    }
+}
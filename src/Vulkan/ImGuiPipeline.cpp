@@ -1,15 +1,67 @@
 #include "Vulkan/ImGuiPipeline.hpp"
 #include "Vulkan/Device.hpp"
 #include "Vulkan/SwapChain.hpp"
+#include "Vulkan/GPUTimings.hpp"
+#include "General/ThreadPool.hpp"
 #include "imgui.hpp"
 
+#include <atomic>
+#include <chrono>
+
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "imstb_rectpack.hpp"
+
 namespace wfe::editor {
     struct PushConstants {
         float32_t scale[2];
     };
+    struct GeometryBuffer {
+        VkBuffer buffer;
+        MemoryAllocation allocation;
+        VkDeviceSize size;
+        void* mappedMemory;
+    };
+    struct DrawStateTracker {
+        VkDescriptorSet descriptorSet;
+        VkRect2D scissor;
+        bool8_t scissorSet;
+    };
+    struct ImGuiTextureResources {
+        VkImage image;
+        MemoryAllocation imageAllocation;
+        VkImageView imageView;
+        VkDescriptorPool descriptorPool;
+        VkDescriptorSet descriptorSet;
+        uint32_t width, height;
+    };
+    struct ImGuiTexture {
+        ImGuiTextureResources resources;
+        ImGuiTextureResources pendingResources;
+        uint64_t pendingUpload;
+        bool8_t ready;
+        uint32_t bindlessIndex;
+    };
+    struct RetiredTexture {
+        ImGuiTextureResources resources;
+        uint64_t upload;
+    };
+    struct DecodedImage {
+        const char_t* filename;
+        const void* encodedData;
+        size_t encodedSize;
+        uint8_t* data;
+        int32_t width, height;
+    };
+    struct PendingDraw {
+        uint32_t indexCount;
+        uint32_t firstIndex;
+        int32_t vertexOffset;
+        uint32_t textureIndex;
+    };
 
     // Constants
 
@@ -116,6 +168,173 @@ namespace wfe::editor {
         0x00000007,0x00000017,0x0000000c,0x00000016,0x0003003e,0x00000009,0x00000017,0x000100fd,
         0x00010038
     };
+    /*
+    #version 450
+    
+    layout(location = 0) in vec2 position;
+    layout(location = 1) in vec2 uvCoord;
+    layout(location = 2) in vec4 color;
+    layout(location = 3) in uint textureIndex;
+    
+    layout(location = 0) out vec2 fragUvCoord;
+    layout(location = 1) out vec4 fragColor;
+    layout(location = 2) flat out uint fragTextureIndex;
+    
+    layout(push_constant) uniform Push {
+        vec2 scale;
+    } push;
+    
+    void main() {
+        gl_Position = vec4(position * push.scale - 1.0, 0.0, 1.0);
+        fragUvCoord = uvCoord;
+        fragColor = color;
+        fragTextureIndex = textureIndex;
+    }
+    */
+    const uint32_t BINDLESS_VERT_SHADER_CODE[] = {
+        0x07230203,0x00010000,0x00000000,0x0000002f,0x00000000,0x00020011,0x00000001,0x0006000b,
+        0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+        0x000d000f,0x00000000,0x00000002,0x6e69616d,0x00000000,0x00000003,0x00000004,0x00000005,
+        0x00000006,0x00000007,0x00000008,0x00000009,0x0000000a,0x00030003,0x00000002,0x000001c2,
+        0x00040005,0x00000002,0x6e69616d,0x00000000,0x00060005,0x0000000b,0x505f6c67,0x65567265,
+        0x78657472,0x00000000,0x00060006,0x0000000b,0x00000000,0x505f6c67,0x7469736f,0x006e6f69,
+        0x00030005,0x00000003,0x00000000,0x00050005,0x00000004,0x69736f70,0x6e6f6974,0x00000000,
+        0x00040005,0x00000005,0x6f437675,0x0064726f,0x00040005,0x00000006,0x6f6c6f63,0x00000072,
+        0x00060005,0x00000007,0x74786574,0x49657275,0x7865646e,0x00000000,0x00040005,0x0000000c,
+        0x68737550,0x00000000,0x00050006,0x0000000c,0x00000000,0x6c616373,0x00000065,0x00040005,
+        0x0000000d,0x68737570,0x00000000,0x00050005,0x00000008,0x67617266,0x6f437655,0x0064726f,
+        0x00050005,0x00000009,0x67617266,0x6f6c6f43,0x00000072,0x00070005,0x0000000a,0x67617266,
+        0x74786554,0x49657275,0x7865646e,0x00000000,0x00050048,0x0000000b,0x00000000,0x0000000b,
+        0x00000000,0x00030047,0x0000000b,0x00000002,0x00040047,0x00000004,0x0000001e,0x00000000,
+        0x00040047,0x00000005,0x0000001e,0x00000001,0x00040047,0x00000006,0x0000001e,0x00000002,
+        0x00040047,0x00000007,0x0000001e,0x00000003,0x00050048,0x0000000c,0x00000000,0x00000023,
+        0x00000000,0x00030047,0x0000000c,0x00000002,0x00040047,0x00000008,0x0000001e,0x00000000,
+        0x00040047,0x00000009,0x0000001e,0x00000001,0x00030047,0x0000000a,0x0000000e,0x00040047,
+        0x0000000a,0x0000001e,0x00000002,0x00020013,0x0000000e,0x00030021,0x0000000f,0x0000000e,
+        0x00030016,0x00000010,0x00000020,0x00040017,0x00000011,0x00000010,0x00000002,0x00040017,
+        0x00000012,0x00000010,0x00000004,0x00040015,0x00000013,0x00000020,0x00000000,0x00040015,
+        0x00000014,0x00000020,0x00000001,0x0003001e,0x0000000b,0x00000012,0x00040020,0x00000015,
+        0x00000003,0x0000000b,0x0004003b,0x00000015,0x00000003,0x00000003,0x0004002b,0x00000014,
+        0x00000016,0x00000000,0x00040020,0x00000017,0x00000001,0x00000011,0x00040020,0x00000018,
+        0x00000001,0x00000012,0x00040020,0x00000019,0x00000001,0x00000013,0x0004003b,0x00000017,
+        0x00000004,0x00000001,0x0004003b,0x00000017,0x00000005,0x00000001,0x0004003b,0x00000018,
+        0x00000006,0x00000001,0x0004003b,0x00000019,0x00000007,0x00000001,0x0003001e,0x0000000c,
+        0x00000011,0x00040020,0x0000001a,0x00000009,0x0000000c,0x0004003b,0x0000001a,0x0000000d,
+        0x00000009,0x00040020,0x0000001b,0x00000009,0x00000011,0x0004002b,0x00000010,0x0000001c,
+        0x3f800000,0x0004002b,0x00000010,0x0000001d,0x00000000,0x0005002c,0x00000011,0x0000001e,
+        0x0000001c,0x0000001c,0x00040020,0x0000001f,0x00000003,0x00000012,0x00040020,0x00000020,
+        0x00000003,0x00000011,0x00040020,0x00000021,0x00000003,0x00000013,0x0004003b,0x00000020,
+        0x00000008,0x00000003,0x0004003b,0x0000001f,0x00000009,0x00000003,0x0004003b,0x00000021,
+        0x0000000a,0x00000003,0x00050036,0x0000000e,0x00000002,0x00000000,0x0000000f,0x000200f8,
+        0x00000022,0x0004003d,0x00000011,0x00000023,0x00000004,0x00050041,0x0000001b,0x00000024,
+        0x0000000d,0x00000016,0x0004003d,0x00000011,0x00000025,0x00000024,0x00050085,0x00000011,
+        0x00000026,0x00000023,0x00000025,0x00050083,0x00000011,0x00000027,0x00000026,0x0000001e,
+        0x00050051,0x00000010,0x00000028,0x00000027,0x00000000,0x00050051,0x00000010,0x00000029,
+        0x00000027,0x00000001,0x00070050,0x00000012,0x0000002a,0x00000028,0x00000029,0x0000001d,
+        0x0000001c,0x00050041,0x0000001f,0x0000002b,0x00000003,0x00000016,0x0003003e,0x0000002b,
+        0x0000002a,0x0004003d,0x00000011,0x0000002c,0x00000005,0x0003003e,0x00000008,0x0000002c,
+        0x0004003d,0x00000012,0x0000002d,0x00000006,0x0003003e,0x00000009,0x0000002d,0x0004003d,
+        0x00000013,0x0000002e,0x00000007,0x0003003e,0x0000000a,0x0000002e,0x000100fd,0x00010038
+    };
+    /*
+    #version 450
+    
+    layout(constant_id = 0) const uint TEXTURE_COUNT = 1;
+    
+    layout(location = 0) in vec2 fragUvCoord;
+    layout(location = 1) in vec4 fragColor;
+    layout(location = 2) flat in uint fragTextureIndex;
+    
+    layout(location = 0) out vec4 outColor;
+    
+    layout(set = 0, binding = 0) uniform sampler2D imageTextures[TEXTURE_COUNT];
+    
+    void main() {
+        outColor = fragColor * texture(imageTextures[fragTextureIndex], fragUvCoord);
+    }
+    */
+    const uint32_t BINDLESS_FRAG_SHADER_CODE[] = {
+        0x07230203,0x00010000,0x00000000,0x00000020,0x00000000,0x00020011,0x00000001,0x00020011,
+        0x0000001d,0x0006000b,0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,
+        0x00000000,0x00000001,0x0009000f,0x00000004,0x00000002,0x6e69616d,0x00000000,0x00000003,
+        0x00000004,0x00000005,0x00000006,0x00030010,0x00000002,0x00000007,0x00030003,0x00000002,
+        0x000001c2,0x00040005,0x00000002,0x6e69616d,0x00000000,0x00050005,0x00000003,0x4374756f,
+        0x726f6c6f,0x00000000,0x00050005,0x00000004,0x67617266,0x6f6c6f43,0x00000072,0x00060005,
+        0x00000007,0x67616d69,0x78655465,0x65727574,0x00000073,0x00060005,0x00000008,0x54584554,
+        0x5f455255,0x4e554f43,0x00000054,0x00070005,0x00000005,0x67617266,0x74786554,0x49657275,
+        0x7865646e,0x00000000,0x00050005,0x00000006,0x67617266,0x6f437655,0x0064726f,0x00040047,
+        0x00000003,0x0000001e,0x00000000,0x00040047,0x00000004,0x0000001e,0x00000001,0x00040047,
+        0x00000008,0x00000001,0x00000000,0x00040047,0x00000007,0x00000022,0x00000000,0x00040047,
+        0x00000007,0x00000021,0x00000000,0x00030047,0x00000005,0x0000000e,0x00040047,0x00000005,
+        0x0000001e,0x00000002,0x00040047,0x00000006,0x0000001e,0x00000000,0x00020013,0x00000009,
+        0x00030021,0x0000000a,0x00000009,0x00030016,0x0000000b,0x00000020,0x00040017,0x0000000c,
+        0x0000000b,0x00000004,0x00040017,0x0000000d,0x0000000b,0x00000002,0x00040020,0x0000000e,
+        0x00000003,0x0000000c,0x0004003b,0x0000000e,0x00000003,0x00000003,0x00040020,0x0000000f,
+        0x00000001,0x0000000c,0x0004003b,0x0000000f,0x00000004,0x00000001,0x00090019,0x00000010,
+        0x0000000b,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,
+        0x00000011,0x00000010,0x00040015,0x00000012,0x00000020,0x00000000,0x00040032,0x00000012,
+        0x00000008,0x00000001,0x0004001c,0x00000013,0x00000011,0x00000008,0x00040020,0x00000014,
+        0x00000000,0x00000013,0x0004003b,0x00000014,0x00000007,0x00000000,0x00040020,0x00000015,
+        0x00000001,0x00000012,0x0004003b,0x00000015,0x00000005,0x00000001,0x00040020,0x00000016,
+        0x00000000,0x00000011,0x00040020,0x00000017,0x00000001,0x0000000d,0x0004003b,0x00000017,
+        0x00000006,0x00000001,0x00050036,0x00000009,0x00000002,0x00000000,0x0000000a,0x000200f8,
+        0x00000018,0x0004003d,0x0000000c,0x00000019,0x00000004,0x0004003d,0x00000012,0x0000001a,
+        0x00000005,0x00050041,0x00000016,0x0000001b,0x00000007,0x0000001a,0x0004003d,0x00000011,
+        0x0000001c,0x0000001b,0x0004003d,0x0000000d,0x0000001d,0x00000006,0x00050057,0x0000000c,
+        0x0000001e,0x0000001c,0x0000001d,0x00050085,0x0000000c,0x0000001f,0x00000019,0x0000001e,
+        0x0003003e,0x00000003,0x0000001f,0x000100fd,0x00010038
+    };
+    /*
+    #version 450
+    #extension GL_EXT_nonuniform_qualifier : require
+    
+    layout(constant_id = 0) const uint TEXTURE_COUNT = 1;
+    
+    layout(location = 0) in vec2 fragUvCoord;
+    layout(location = 1) in vec4 fragColor;
+    layout(location = 2) flat in uint fragTextureIndex;
+    
+    layout(location = 0) out vec4 outColor;
+    
+    layout(set = 0, binding = 0) uniform sampler2D imageTextures[TEXTURE_COUNT];
+    
+    void main() {
+        outColor = fragColor * texture(imageTextures[nonuniformEXT(fragTextureIndex)], fragUvCoord);
+    }
+    */
+    const uint32_t BINDLESS_NON_UNIFORM_FRAG_SHADER_CODE[] = {
+        0x07230203,0x00010000,0x00000000,0x00000020,0x00000000,0x00020011,0x00000001,0x00020011,
+        0x000014b5,0x00020011,0x000014bb,0x0008000a,0x5f565053,0x5f545845,0x63736564,0x74706972,
+        0x695f726f,0x7865646e,0x00676e69,0x0006000b,0x00000001,0x4c534c47,0x6474732e,0x3035342e,
+        0x00000000,0x0003000e,0x00000000,0x00000001,0x0009000f,0x00000004,0x00000002,0x6e69616d,
+        0x00000000,0x00000003,0x00000004,0x00000005,0x00000006,0x00030010,0x00000002,0x00000007,
+        0x00030003,0x00000002,0x000001c2,0x00040005,0x00000002,0x6e69616d,0x00000000,0x00050005,
+        0x00000003,0x4374756f,0x726f6c6f,0x00000000,0x00050005,0x00000004,0x67617266,0x6f6c6f43,
+        0x00000072,0x00060005,0x00000007,0x67616d69,0x78655465,0x65727574,0x00000073,0x00060005,
+        0x00000008,0x54584554,0x5f455255,0x4e554f43,0x00000054,0x00070005,0x00000005,0x67617266,
+        0x74786554,0x49657275,0x7865646e,0x00000000,0x00050005,0x00000006,0x67617266,0x6f437655,
+        0x0064726f,0x00040047,0x00000003,0x0000001e,0x00000000,0x00040047,0x00000004,0x0000001e,
+        0x00000001,0x00040047,0x00000008,0x00000001,0x00000000,0x00040047,0x00000007,0x00000022,
+        0x00000000,0x00040047,0x00000007,0x00000021,0x00000000,0x00030047,0x00000005,0x0000000e,
+        0x00040047,0x00000005,0x0000001e,0x00000002,0x00030047,0x00000009,0x000014b4,0x00030047,
+        0x0000000a,0x000014b4,0x00030047,0x0000000b,0x000014b4,0x00040047,0x00000006,0x0000001e,
+        0x00000000,0x00020013,0x0000000c,0x00030021,0x0000000d,0x0000000c,0x00030016,0x0000000e,
+        0x00000020,0x00040017,0x0000000f,0x0000000e,0x00000004,0x00040017,0x00000010,0x0000000e,
+        0x00000002,0x00040020,0x00000011,0x00000003,0x0000000f,0x0004003b,0x00000011,0x00000003,
+        0x00000003,0x00040020,0x00000012,0x00000001,0x0000000f,0x0004003b,0x00000012,0x00000004,
+        0x00000001,0x00090019,0x00000013,0x0000000e,0x00000001,0x00000000,0x00000000,0x00000000,
+        0x00000001,0x00000000,0x0003001b,0x00000014,0x00000013,0x00040015,0x00000015,0x00000020,
+        0x00000000,0x00040032,0x00000015,0x00000008,0x00000001,0x0004001c,0x00000016,0x00000014,
+        0x00000008,0x00040020,0x00000017,0x00000000,0x00000016,0x0004003b,0x00000017,0x00000007,
+        0x00000000,0x00040020,0x00000018,0x00000001,0x00000015,0x0004003b,0x00000018,0x00000005,
+        0x00000001,0x00040020,0x00000019,0x00000000,0x00000014,0x00040020,0x0000001a,0x00000001,
+        0x00000010,0x0004003b,0x0000001a,0x00000006,0x00000001,0x00050036,0x0000000c,0x00000002,
+        0x00000000,0x0000000d,0x000200f8,0x0000001b,0x0004003d,0x0000000f,0x0000001c,0x00000004,
+        0x0004003d,0x00000015,0x00000009,0x00000005,0x00050041,0x00000019,0x0000000a,0x00000007,
+        0x00000009,0x0004003d,0x00000014,0x0000000b,0x0000000a,0x0004003d,0x00000010,0x0000001d,
+        0x00000006,0x00050057,0x0000000f,0x0000001e,0x0000000b,0x0000001d,0x00050085,0x0000000f,
+        0x0000001f,0x0000001c,0x0000001e,0x0003003e,0x00000003,0x0000001f,0x000100fd,0x00010038
+    };
 
     const vector<string> IMAGE_FILENAMES = {
         "assets/images/File.png",
@@ -123,52 +342,185 @@ namespace wfe::editor {
         "assets/images/FolderFull.png"
     };
 
+    const VkDeviceSize MIN_GEOMETRY_BUFFER_SIZE = 65536;
+    const uint32_t MAX_BINDLESS_TEXTURE_COUNT = 256;
+    const uint32_t INVALID_TEXTURE_INDEX = UINT32_MAX;
+    const uint32_t TEXTURE_DESCRIPTOR_POOL_SIZE = 64;
+    const uint32_t MAX_ICON_ATLAS_SIZE = 4096;
+    const int32_t ICON_ATLAS_PADDING = 1;
+
+    const uint64_t FINGERPRINT_OFFSET_BASIS = 0xcbf29ce484222325;
+    const uint64_t FINGERPRINT_PRIME = 0x00000100000001b3;
+
     // Variables
     VkPipeline pipeline;
     VkPipelineLayout layout;
     VkShaderModule vertShaderModule, fragShaderModule;
     VkSampler sampler;
-    VkCommandBuffer commandBuffer;
+    VkCommandBuffer commandBuffers[MAX_FRAMES_IN_FLIGHT];
+
+    VkDescriptorSetLayout textureDescriptorSetLayout;
+    vector<VkDescriptorPool> textureDescriptorPools;
+
+    vector<ImGuiTexture*> textures;
+    size_t pendingTextureCount = 0;
+    vector<RetiredTexture> retiredTextures;
+    vector<ImGuiTexture*> releasedTextures;
+
+    ImGuiTexture* fontTexture;
+    vector<ImGuiTextureRegion> imageRegions;
+    size_t iconAtlasCount = 0;
+
+    vector<string> startupImageFilenames;
+    vector<DecodedImage> startupImages;
+    std::atomic<size_t> decodedStartupImageCount{ 0 };
+
+    GeometryBuffer vertexBuffers[MAX_FRAMES_IN_FLIGHT];
+    GeometryBuffer indexBuffers[MAX_FRAMES_IN_FLIGHT];
+    GeometryBuffer textureIndexBuffers[MAX_FRAMES_IN_FLIGHT];
+
+    bool8_t bindlessRequested = false;
+    bool8_t bindlessEnabled = false;
+    bool8_t bindlessNonUniform = false;
+    uint32_t bindlessTextureCount = 0;
+    VkDescriptorPool bindlessDescriptorPool;
+    VkDescriptorSetLayout bindlessDescriptorSetLayout;
+    VkDescriptorSet bindlessDescriptorSets[MAX_FRAMES_IN_FLIGHT];
+    vector<ImGuiTexture*> bindlessSlots;
+    uint64_t bindlessVersion = 1;
+    uint64_t bindlessSetVersions[MAX_FRAMES_IN_FLIGHT];
+    VkPipelineLayout bindlessLayout;
+    VkShaderModule bindlessVertShaderModule, bindlessFragShaderModule;
+    VkPipeline bindlessPipeline;
+
+    ImGuiPipelineStats stats;
+
+    bool8_t presentOnChange = true;
+    bool8_t redrawRequested = true;
+    uint64_t lastPresentedFingerprint = 0;
+    uint64_t currentFingerprint = 0;
+    int32_t currentFingerprintFrame = -1;
+
+    static void AssignBindlessSlot(ImGuiTexture* texture) {
+        texture->bindlessIndex = INVALID_TEXTURE_INDEX;
+
+        // Look for a free slot; if every slot is taken, the texture will be drawn with its own descriptor set
+        for(uint32_t i = 0; i < bindlessSlots.size(); ++i)
+            if(!bindlessSlots[i]) {
+                bindlessSlots[i] = texture;
+                texture->bindlessIndex = i;
+                ++bindlessVersion;
+                break;
+            }
+    }
+    static void FreeBindlessSlot(ImGuiTexture* texture) {
+        // Exit the function if the texture doesn't have a slot
+        if(texture->bindlessIndex == INVALID_TEXTURE_INDEX)
+            return;
+        
+        // Free the slot; draws that still reference the texture will use its own descriptor set
+        bindlessSlots[texture->bindlessIndex] = nullptr;
+        texture->bindlessIndex = INVALID_TEXTURE_INDEX;
+        ++bindlessVersion;
+    }
+    static void UpdateBindlessDescriptorSet() {
+        // Exit the function if the current frame's descriptor set is up to date
+        uint32_t currentFrame = GetCurrentFrame();
+        if(bindlessSetVersions[currentFrame] == bindlessVersion)
+            return;
+        
+        // Set the descriptor image infos; free slots point to the font texture, so every slot is always valid
+        vector<VkDescriptorImageInfo> descriptorImageInfos(bindlessTextureCount);
+        for(uint32_t i = 0; i < bindlessTextureCount; ++i) {
+            ImGuiTexture* texture = bindlessSlots[i] ? bindlessSlots[i] : fontTexture;
+
+            descriptorImageInfos[i].sampler = sampler;
+            descriptorImageInfos[i].imageView = texture->resources.imageView;
+            descriptorImageInfos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        }
 
-    VkDescriptorPool descriptorPool;
-    VkDescriptorSetLayout fontDescriptorSetLayout;
-    VkDescriptorSet fontDescriptorSet;
-    VkImage fontImage;
-    VkDeviceMemory fontImageMemory;
-    VkImageView fontImageView;
-    vector<VkDescriptorSet> imageDescriptorSets;
-    vector<VkImage> images;
-    vector<VkDeviceMemory> imageMemories;
-    vector<VkImageView> imageViews;
+        // Set the descriptor set write info
+        VkWriteDescriptorSet write;
 
-    static void CreateImGuiImage(size_t width, size_t height, void* data, VkDescriptorSet descriptorSet, VkImage& image, VkDeviceMemory& imageMemory, VkImageView& imageView) {
-        // Create the staging buffer
-        VkDeviceSize imageSize = (VkDeviceSize)(width * height * 4);
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.pNext = nullptr;
+        write.dstSet = bindlessDescriptorSets[currentFrame];
+        write.dstBinding = 0;
+        write.dstArrayElement = 0;
+        write.descriptorCount = bindlessTextureCount;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = descriptorImageInfos.data();
+        write.pBufferInfo = nullptr;
+        write.pTexelBufferView = nullptr;
 
-        VkBuffer stagingBuffer;
-        VkDeviceMemory stagingBufferMemory;
+        // Update the descriptor set; the frame's fence was already waited on, so the GPU isn't using it anymore
+        vkUpdateDescriptorSets(GetDevice(), 1, &write, 0, nullptr);
 
-        CreateBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, stagingBuffer, stagingBufferMemory);
+        bindlessSetVersions[currentFrame] = bindlessVersion;
+    }
+    static uint32_t FindBindlessTextureIndex(ImTextureID textureId) {
+        return textureId ? ((ImGuiTexture*)textureId)->bindlessIndex : INVALID_TEXTURE_INDEX;
+    }
+    static bool8_t IsTextureReady(ImTextureID textureId) {
+        return textureId && ((ImGuiTexture*)textureId)->ready;
+    }
+    static void CreateTextureDescriptorPool() {
+        // Set the descriptor pool size
+        VkDescriptorPoolSize poolSize = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, TEXTURE_DESCRIPTOR_POOL_SIZE };
 
-        // Write to the staging buffer
-        void* mappedMemory;
+        // Set the descriptor pool create info
+        VkDescriptorPoolCreateInfo createInfo;
 
-        VkResult mapResult = vkMapMemory(GetDevice(), stagingBufferMemory, 0, VK_WHOLE_SIZE, 0, &mappedMemory);
+        createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        createInfo.maxSets = TEXTURE_DESCRIPTOR_POOL_SIZE;
+        createInfo.poolSizeCount = 1;
+        createInfo.pPoolSizes = &poolSize;
 
-        memcpy(mappedMemory, data, (size_t)imageSize);
+        // Create the descriptor pool
+        VkDescriptorPool descriptorPool;
 
-        VkMappedMemoryRange memoryRange;
+        auto result = vkCreateDescriptorPool(GetDevice(), &createInfo, GetVulkanAllocator(), &descriptorPool);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create descriptor pool! Error code: " + VkResultToString(result), 1);
+        
+        textureDescriptorPools.push_back(descriptorPool);
+    }
+    static void AllocateTextureDescriptorSet(ImGuiTextureResources& texture) {
+        // Set the descriptor set alloc info
+        VkDescriptorSetAllocateInfo allocInfo;
 
-        memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        memoryRange.pNext = nullptr;
-        memoryRange.memory = stagingBufferMemory;
-        memoryRange.offset = 0;
-        memoryRange.size = imageSize;
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext = nullptr;
+        allocInfo.descriptorPool = VK_NULL_HANDLE;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &textureDescriptorSetLayout;
 
-        vkFlushMappedMemoryRanges(GetDevice(), 1, &memoryRange);
+        // Try every pool, starting with the newest one, since destroyed textures free their descriptor sets back to their own pools
+        for(size_t i = textureDescriptorPools.size(); i; --i) {
+            allocInfo.descriptorPool = textureDescriptorPools[i - 1];
 
-        vkUnmapMemory(GetDevice(), stagingBufferMemory);
+            auto result = vkAllocateDescriptorSets(GetDevice(), &allocInfo, &texture.descriptorSet);
+            if(result == VK_SUCCESS) {
+                texture.descriptorPool = allocInfo.descriptorPool;
+                return;
+            }
+            if(result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL)
+                console::OutFatalError((string)"Failed to allocate descriptor set! Error code: " + VkResultToString(result), 1);
+        }
+
+        // Every pool is full, so allocate the descriptor set from a new pool
+        CreateTextureDescriptorPool();
+        allocInfo.descriptorPool = textureDescriptorPools.back();
 
+        auto result = vkAllocateDescriptorSets(GetDevice(), &allocInfo, &texture.descriptorSet);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to allocate descriptor set! Error code: " + VkResultToString(result), 1);
+        
+        texture.descriptorPool = allocInfo.descriptorPool;
+    }
+    static void CreateTextureImage(ImGuiTextureResources& texture) {
         // Set the image create info
         VkImageCreateInfo imageInfo;
 
@@ -177,7 +529,7 @@ namespace wfe::editor {
         imageInfo.flags = 0;
         imageInfo.imageType = VK_IMAGE_TYPE_2D;
         imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
-        imageInfo.extent = { (uint32_t)width, (uint32_t)height, 1 };
+        imageInfo.extent = { texture.width, texture.height, 1 };
         imageInfo.mipLevels = 1;
         imageInfo.arrayLayers = 1;
         imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
@@ -189,7 +541,7 @@ namespace wfe::editor {
         imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
         // Create the image        
-        CreateImage(imageInfo, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, image, imageMemory);
+        CreateImage(imageInfo, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, texture.image, texture.imageAllocation);
 
         // Set the image view create info
         VkImageViewCreateInfo imageViewInfo;
@@ -197,7 +549,7 @@ namespace wfe::editor {
         imageViewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         imageViewInfo.pNext = nullptr;
         imageViewInfo.flags = 0;
-        imageViewInfo.image = image;
+        imageViewInfo.image = texture.image;
         imageViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
         imageViewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
         imageViewInfo.components = { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY };
@@ -209,26 +561,16 @@ namespace wfe::editor {
         imageViewInfo.subresourceRange.layerCount = 1;
 
         // Create the image view
-        auto result = vkCreateImageView(GetDevice(), &imageViewInfo, GetVulkanAllocator(), &imageView);
+        auto result = vkCreateImageView(GetDevice(), &imageViewInfo, GetVulkanAllocator(), &texture.imageView);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to create image view! Error code: " + VkResultToString(result), 1);
-
-        // Begin single time commands
-        VkCommandBuffer commandBuffer = BeginSingleTimeCommands();
-
-        // Copy to the image
-        TransitionImageLayout(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_FORMAT_R8G8B8A8_UNORM, commandBuffer);
-        CopyBufferToImage(stagingBuffer, image, (uint32_t)width, (uint32_t)height, 1, commandBuffer);
-        TransitionImageLayout(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_FORMAT_R8G8B8A8_UNORM, commandBuffer);
-
-        // End single time commands
-        EndSingleTimeCommands(commandBuffer);
-
+    }
+    static void WriteTextureDescriptorSet(const ImGuiTextureResources& texture) {
         // Set the descriptor image info
         VkDescriptorImageInfo descriptorImageInfo;
 
         descriptorImageInfo.sampler = sampler;
-        descriptorImageInfo.imageView = imageView;
+        descriptorImageInfo.imageView = texture.imageView;
         descriptorImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
         // Set the descriptor set write info
@@ -236,20 +578,145 @@ namespace wfe::editor {
 
         write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         write.pNext = nullptr;
-        write.dstSet = descriptorSet;
+        write.dstSet = texture.descriptorSet;
         write.dstBinding = 0;
         write.dstArrayElement = 0;
         write.descriptorCount = 1;
         write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
         write.pImageInfo = &descriptorImageInfo;
         write.pBufferInfo = nullptr;
+        write.pTexelBufferView = nullptr;
         
-        // Update the descriptor sets
+        // Update the descriptor set
         vkUpdateDescriptorSets(GetDevice(), 1, &write, 0, nullptr);
+    }
+    static uint64_t CreateTextureResources(ImGuiTextureResources& texture, const void* data) {
+        CreateTextureImage(texture);
+
+        AllocateTextureDescriptorSet(texture);
+        WriteTextureDescriptorSet(texture);
+
+        // Queue the pixel data's upload, which finishes in the background
+        return UploadImageData(texture.image, texture.width, texture.height, data, (VkDeviceSize)texture.width * texture.height * 4);
+    }
+    static void DestroyTextureResources(ImGuiTextureResources& texture) {
+        vkDestroyImageView(GetDevice(), texture.imageView, GetVulkanAllocator());
+        vkDestroyImage(GetDevice(), texture.image, GetVulkanAllocator());
+        FreeMemory(texture.imageAllocation);
+    }
+    static void DeferDestroyTextureResources(const ImGuiTextureResources& texture) {
+        // Frames that were already submitted might still use the resources, so destroy them once those frames finish
+        DeferDestroyImageView(texture.imageView);
+        DeferDestroyImage(texture.image);
+        DeferFreeMemory(texture.imageAllocation);
+        DeferFreeDescriptorSet(texture.descriptorPool, texture.descriptorSet);
+    }
+    static void RetireTexture(const ImGuiTextureResources& resources, uint64_t upload) {
+        // Defer the resources' destruction right away, unless their upload is still in flight
+        if(!upload || IsUploadComplete(upload)) {
+            DeferDestroyTextureResources(resources);
+            return;
+        }
+
+        RetiredTexture retiredTexture;
+
+        retiredTexture.resources = resources;
+        retiredTexture.upload = upload;
+
+        retiredTextures.push_back(retiredTexture);
+    }
+    static void DeferRetiredTextures() {
+        for(size_t i = 0; i < retiredTextures.size();) {
+            // Skip the texture if the transfer queue might still be writing to it
+            if(!IsUploadComplete(retiredTextures[i].upload)) {
+                ++i;
+                continue;
+            }
+
+            DeferDestroyTextureResources(retiredTextures[i].resources);
+
+            // Remove the texture from the list
+            retiredTextures[i] = retiredTextures.back();
+            retiredTextures.pop_back();
+        }
+    }
+    static void DeleteReleasedTextures() {
+        // The released textures' records are no longer referenced by any draw data, so delete them
+        for(ImGuiTexture* texture : releasedTextures)
+            delete texture;
+        releasedTextures.clear();
+    }
+    static void SwapFinishedTextureUploads() {
+        // Exit the function if no textures are waiting for their uploads
+        if(!pendingTextureCount)
+            return;
+        
+        for(ImGuiTexture* texture : textures) {
+            // Skip the texture if it has no pending upload or if its upload isn't complete yet
+            if(!texture->pendingUpload || !IsUploadComplete(texture->pendingUpload))
+                continue;
+            
+            // Retire the texture's old resources and replace them with the uploaded ones
+            if(texture->ready)
+                RetireTexture(texture->resources, 0);
+            
+            texture->resources = texture->pendingResources;
+            texture->pendingUpload = 0;
+            texture->ready = true;
+            --pendingTextureCount;
+
+            // Point the texture's bindless slot to the new image, or give it a slot if it just became ready
+            if(bindlessEnabled) {
+                if(texture->bindlessIndex == INVALID_TEXTURE_INDEX)
+                    AssignBindlessSlot(texture);
+                else
+                    ++bindlessVersion;
+            }
 
-        // Delete the staging buffer
-        vkDestroyBuffer(GetDevice(), stagingBuffer, GetVulkanAllocator());
-        vkFreeMemory(GetDevice(), stagingBufferMemory, GetVulkanAllocator());
+            // The draw data might not change, so make sure the new contents are presented
+            redrawRequested = true;
+        }
+    }
+
+    static void DestroyGeometryBuffer(GeometryBuffer& geometryBuffer) {
+        // Exit the function if the buffer was never created
+        if(!geometryBuffer.buffer)
+            return;
+
+        // Destroy the buffer and free its memory
+        vkDestroyBuffer(GetDevice(), geometryBuffer.buffer, GetVulkanAllocator());
+        FreeMemory(geometryBuffer.allocation);
+
+        geometryBuffer.buffer = VK_NULL_HANDLE;
+        geometryBuffer.size = 0;
+        geometryBuffer.mappedMemory = nullptr;
+    }
+    static void ReserveGeometryBuffer(GeometryBuffer& geometryBuffer, VkDeviceSize size, VkBufferUsageFlags usage, VkDeviceSize& capacityStat) {
+        // Exit the function if the buffer is already large enough
+        if(size <= geometryBuffer.size)
+            return;
+        
+        // Grow the buffer's size geometrically until it fits the requested size
+        VkDeviceSize newSize = geometryBuffer.size ? geometryBuffer.size : MIN_GEOMETRY_BUFFER_SIZE;
+        while(newSize < size)
+            newSize <<= 1;
+        newSize = PadUniformBufferSize(newSize);
+
+        // Hand the old buffer to the deferred deletion queue, which destroys it once no submitted frame can use it
+        if(geometryBuffer.buffer) {
+            DeferDestroyBuffer(geometryBuffer.buffer);
+            DeferFreeMemory(geometryBuffer.allocation);
+        }
+
+        // Create the new buffer; its memory stays mapped for its entire lifetime
+        CreateBuffer(newSize, usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, geometryBuffer.buffer, geometryBuffer.allocation);
+
+        geometryBuffer.size = newSize;
+        geometryBuffer.mappedMemory = geometryBuffer.allocation.mappedMemory;
+
+        // Update the stats
+        ++stats.geometryBufferGrowCount;
+        capacityStat = newSize;
     }
 
     static void ConfigureImGuiBackend() {
@@ -284,31 +751,63 @@ namespace wfe::editor {
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to create sampler! Error code: " + VkResultToString(result), 1);
     }
-    static void CreateDescriptorPool() {
-        // Set the descriptor pool size
-        VkDescriptorPoolSize poolSize = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, (uint32_t)(1 + IMAGE_FILENAMES.size()) };
+    static void CreateTextureDescriptorSetLayout() {
+        // Set the descriptor set layout binding
+        VkDescriptorSetLayoutBinding binding;
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        binding.pImmutableSamplers = nullptr;
 
-        // Set the descriptor pool create info
-        VkDescriptorPoolCreateInfo createInfo;
+        // Set the descriptor set layout create info
+        VkDescriptorSetLayoutCreateInfo createInfo;
 
-        createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
         createInfo.pNext = nullptr;
         createInfo.flags = 0;
-        createInfo.maxSets = (VkDeviceSize)(1 + IMAGE_FILENAMES.size());
-        createInfo.poolSizeCount = 1;
-        createInfo.pPoolSizes = &poolSize;
+        createInfo.bindingCount = 1;
+        createInfo.pBindings = &binding;
 
-        // Create the descriptor pool
-        auto result = vkCreateDescriptorPool(GetDevice(), &createInfo, GetVulkanAllocator(), &descriptorPool);
+        // Create the descriptor set layout
+        auto result = vkCreateDescriptorSetLayout(GetDevice(), &createInfo, GetVulkanAllocator(), &textureDescriptorSetLayout);
         if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to create descriptor pool! Error code: " + VkResultToString(result), 1);
+            console::OutFatalError((string)"Failed to create texture descriptor set layout! Error code: " + VkResultToString(result), 1);
+    }
+    static void CheckBindlessSupport() {
+        // Exit the function if the bindless path wasn't requested
+        if(!bindlessRequested)
+            return;
+        
+        // Check if the texture array can be indexed per vertex, or at least per draw
+        bindlessNonUniform = GetDescriptorIndexingFeatures().shaderSampledImageArrayNonUniformIndexing;
+        if(!bindlessNonUniform && !GetPhysicalDeviceFeatures().shaderSampledImageArrayDynamicIndexing) {
+            console::OutMessageFunction("Bindless ImGui textures aren't supported by the GPU; using one descriptor set per texture instead.");
+            return;
+        }
+
+        // Size the texture array to fit the device's limits
+        const VkPhysicalDeviceLimits& limits = GetPhysicalDeviceProperties().limits;
+
+        bindlessTextureCount = MAX_BINDLESS_TEXTURE_COUNT;
+        bindlessTextureCount = limits.maxPerStageDescriptorSamplers < bindlessTextureCount ? limits.maxPerStageDescriptorSamplers : bindlessTextureCount;
+        bindlessTextureCount = limits.maxPerStageDescriptorSampledImages < bindlessTextureCount ? limits.maxPerStageDescriptorSampledImages : bindlessTextureCount;
+        bindlessTextureCount = limits.maxDescriptorSetSamplers < bindlessTextureCount ? limits.maxDescriptorSetSamplers : bindlessTextureCount;
+        bindlessTextureCount = limits.maxDescriptorSetSampledImages < bindlessTextureCount ? limits.maxDescriptorSetSampledImages : bindlessTextureCount;
+
+        bindlessEnabled = true;
+        bindlessSlots.resize(bindlessTextureCount);
+        for(uint32_t i = 0; i < bindlessTextureCount; ++i)
+            bindlessSlots[i] = nullptr;
+
+        console::OutMessageFunction((string)"Using bindless ImGui textures with " + ToString(bindlessTextureCount) + (bindlessNonUniform ? " non-uniformly indexed slots." : " uniformly indexed slots."));
     }
-    static void CreateFontDescriptorSets() {
+    static void CreateBindlessDescriptorSet() {
         // Set the descriptor set layout binding
         VkDescriptorSetLayoutBinding binding;
         binding.binding = 0;
         binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        binding.descriptorCount = 1;
+        binding.descriptorCount = bindlessTextureCount;
         binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
         binding.pImmutableSamplers = nullptr;
 
@@ -322,74 +821,251 @@ namespace wfe::editor {
         createInfo.pBindings = &binding;
 
         // Create the descriptor set layout
-        auto result = vkCreateDescriptorSetLayout(GetDevice(), &createInfo, GetVulkanAllocator(), &fontDescriptorSetLayout);
+        auto result = vkCreateDescriptorSetLayout(GetDevice(), &createInfo, GetVulkanAllocator(), &bindlessDescriptorSetLayout);
         if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to create font descriptor set layout! Error code: " + VkResultToString(result), 1);
+            console::OutFatalError((string)"Failed to create bindless descriptor set layout! Error code: " + VkResultToString(result), 1);
+        
+        // Set the descriptor pool size; every frame in flight has its own copy of the array, so it can be updated while other frames use theirs
+        VkDescriptorPoolSize poolSize = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, (uint32_t)(bindlessTextureCount * MAX_FRAMES_IN_FLIGHT) };
+
+        // Set the descriptor pool create info
+        VkDescriptorPoolCreateInfo poolInfo;
+
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.pNext = nullptr;
+        poolInfo.flags = 0;
+        poolInfo.maxSets = MAX_FRAMES_IN_FLIGHT;
+        poolInfo.poolSizeCount = 1;
+        poolInfo.pPoolSizes = &poolSize;
 
+        // Create the descriptor pool
+        result = vkCreateDescriptorPool(GetDevice(), &poolInfo, GetVulkanAllocator(), &bindlessDescriptorPool);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to create bindless descriptor pool! Error code: " + VkResultToString(result), 1);
+        
         // Create the array of descriptor set layouts
         VkDescriptorSetLayout layouts[MAX_FRAMES_IN_FLIGHT];
         for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
-            layouts[i] = fontDescriptorSetLayout;
+            layouts[i] = bindlessDescriptorSetLayout;
 
         // Set the descriptor set alloc info
         VkDescriptorSetAllocateInfo allocInfo;
 
         allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
         allocInfo.pNext = nullptr;
-        allocInfo.descriptorPool = descriptorPool;
-        allocInfo.descriptorSetCount = 1;
+        allocInfo.descriptorPool = bindlessDescriptorPool;
+        allocInfo.descriptorSetCount = MAX_FRAMES_IN_FLIGHT;
         allocInfo.pSetLayouts = layouts;
 
-        // Allocate the font descriptor set
-        result = vkAllocateDescriptorSets(GetDevice(), &allocInfo, &fontDescriptorSet);
+        // Allocate the bindless descriptor sets
+        result = vkAllocateDescriptorSets(GetDevice(), &allocInfo, bindlessDescriptorSets);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to allocate descriptor set! Error code: " + VkResultToString(result), 1);
+    }
+    static void DecodeImage(size_t index, void* userData) {
+        DecodedImage& image = ((DecodedImage*)userData)[index];
+
+        // Decode the image from its file or from memory, converting it to RGBA
+        int32_t channels;
+        if(image.filename)
+            image.data = stbi_load(image.filename, &image.width, &image.height, &channels, STBI_rgb_alpha);
+        else
+            image.data = stbi_load_from_memory((const stbi_uc*)image.encodedData, (int32_t)image.encodedSize, &image.width, &image.height, &channels, STBI_rgb_alpha);
+    }
+    static void LoadDecodedImages(size_t count, DecodedImage* images, ImTextureID* textureIds) {
+        // Decode every image on the worker threads
+        ParallelFor(count, DecodeImage, images);
+
+        // Register every decoded image; their uploads are queued into the same batch
+        for(size_t i = 0; i < count; ++i) {
+            if(!images[i].data) {
+                console::OutWarningFunction((string)"Failed to decode image " + (images[i].filename ? images[i].filename : ToString(i).c_str()) + "!");
+                textureIds[i] = nullptr;
+                continue;
+            }
 
-        // Allocate every other descriptor set
-        imageDescriptorSets.resize(IMAGE_FILENAMES.size());
+            textureIds[i] = RegisterImGuiTexture((size_t)images[i].width, (size_t)images[i].height, images[i].data);
+            stbi_image_free(images[i].data);
+        }
+    }
+    static void CopyIconPixels(const DecodedImage& image, uint8_t* atlasPixels, int32_t atlasWidth, int32_t x, int32_t y) {
+        const uint32_t* srcPixels = (const uint32_t*)image.data;
+        uint32_t* dstPixels = (uint32_t*)atlasPixels;
 
-        for(VkDescriptorSet& descriptorSet : imageDescriptorSets) {
-            result = vkAllocateDescriptorSets(GetDevice(), &allocInfo, &descriptorSet);
-            if(result != VK_SUCCESS)
-                console::OutFatalError((string)"Failed to allocate descriptor set! Error code: " + VkResultToString(result), 1);
+        // Copy the icon into the atlas, repeating its edge pixels into the padding so linear filtering doesn't bleed in its neighbours
+        for(int32_t dstY = -ICON_ATLAS_PADDING; dstY < image.height + ICON_ATLAS_PADDING; ++dstY) {
+            int32_t srcY = dstY < 0 ? 0 : (dstY < image.height ? dstY : image.height - 1);
+
+            for(int32_t dstX = -ICON_ATLAS_PADDING; dstX < image.width + ICON_ATLAS_PADDING; ++dstX) {
+                int32_t srcX = dstX < 0 ? 0 : (dstX < image.width ? dstX : image.width - 1);
+                dstPixels[(size_t)(y + ICON_ATLAS_PADDING + dstY) * atlasWidth + x + ICON_ATLAS_PADDING + dstX] = srcPixels[(size_t)srcY * image.width + srcX];
+            }
+        }
+    }
+    static void PackDecodedIcons(size_t count, DecodedImage* images, ImGuiTextureRegion* regions) {
+        // Set the packing rect of every decoded icon, including its padding
+        vector<stbrp_rect> rects;
+        for(size_t i = 0; i < count; ++i) {
+            if(!images[i].data) {
+                console::OutWarningFunction((string)"Failed to decode icon " + (images[i].filename ? images[i].filename : ToString(i).c_str()) + "!");
+                regions[i] = { nullptr, ImVec2(0.f, 0.f), ImVec2(0.f, 0.f) };
+                continue;
+            }
+
+            stbrp_rect rect;
+
+            rect.id = (int32_t)i;
+            rect.w = images[i].width + 2 * ICON_ATLAS_PADDING;
+            rect.h = images[i].height + 2 * ICON_ATLAS_PADDING;
+            rect.x = 0;
+            rect.y = 0;
+            rect.was_packed = 0;
+
+            rects.push_back(rect);
+        }
+
+        // Clamp the atlas size to the device's limit
+        int32_t maxAtlasSize = (int32_t)MAX_ICON_ATLAS_SIZE;
+        if(GetPhysicalDeviceProperties().limits.maxImageDimension2D < MAX_ICON_ATLAS_SIZE)
+            maxAtlasSize = (int32_t)GetPhysicalDeviceProperties().limits.maxImageDimension2D;
+
+        vector<stbrp_node> nodes((size_t)maxAtlasSize);
+
+        // Pack the icons into as few atlases as possible, each one as small as its contents
+        while(!rects.empty()) {
+            stbrp_context context;
+            stbrp_init_target(&context, maxAtlasSize, maxAtlasSize, nodes.data(), maxAtlasSize);
+            stbrp_pack_rects(&context, rects.data(), (int32_t)rects.size());
+
+            // Find the size of the packed area
+            int32_t atlasWidth = 0, atlasHeight = 0;
+            for(const stbrp_rect& rect : rects) {
+                if(!rect.was_packed)
+                    continue;
+                if(rect.x + rect.w > atlasWidth)
+                    atlasWidth = rect.x + rect.w;
+                if(rect.y + rect.h > atlasHeight)
+                    atlasHeight = rect.y + rect.h;
+            }
+
+            // Exit the loop if no icon fit; every remaining icon is larger than an atlas
+            if(!atlasWidth)
+                break;
+            
+            // Copy every packed icon into the atlas
+            vector<uint8_t> atlasPixels((size_t)atlasWidth * atlasHeight * 4);
+            memset(atlasPixels.data(), 0, atlasPixels.size());
+
+            for(const stbrp_rect& rect : rects)
+                if(rect.was_packed)
+                    CopyIconPixels(images[rect.id], atlasPixels.data(), atlasWidth, rect.x, rect.y);
+            
+            // Register the atlas and set every packed icon's region
+            ImTextureID atlasId = RegisterImGuiTexture((size_t)atlasWidth, (size_t)atlasHeight, atlasPixels.data());
+            ++iconAtlasCount;
+
+            for(size_t i = 0; i < rects.size();) {
+                if(!rects[i].was_packed) {
+                    ++i;
+                    continue;
+                }
+
+                const stbrp_rect& rect = rects[i];
+                ImGuiTextureRegion& region = regions[rect.id];
+
+                region.textureId = atlasId;
+                region.uv0 = ImVec2((float32_t)(rect.x + ICON_ATLAS_PADDING) / atlasWidth, (float32_t)(rect.y + ICON_ATLAS_PADDING) / atlasHeight);
+                region.uv1 = ImVec2((float32_t)(rect.x + rect.w - ICON_ATLAS_PADDING) / atlasWidth, (float32_t)(rect.y + rect.h - ICON_ATLAS_PADDING) / atlasHeight);
+
+                // Remove the rect from the list of icons left to pack
+                rects[i] = rects.back();
+                rects.pop_back();
+            }
+        }
+
+        // Register every icon too large for an atlas as its own texture
+        for(const stbrp_rect& rect : rects) {
+            console::OutWarningFunction((string)"Icon " + ToString((size_t)rect.id) + " is too large for the icon atlas; it will be drawn from its own texture.");
+            regions[rect.id] = { RegisterImGuiTexture((size_t)images[rect.id].width, (size_t)images[rect.id].height, images[rect.id].data), ImVec2(0.f, 0.f), ImVec2(1.f, 1.f) };
+        }
+
+        // Free every decoded icon
+        for(size_t i = 0; i < count; ++i)
+            if(images[i].data)
+                stbi_image_free(images[i].data);
+    }
+    static void PrepareStartupImages() {
+        // Exit the function if the images were already prepared
+        if(startupImages.size())
+            return;
+        
+        // Get every image's filename
+        startupImageFilenames.resize(IMAGE_FILENAMES.size());
+        startupImages.resize(IMAGE_FILENAMES.size());
+
+        for(size_t i = 0; i < IMAGE_FILENAMES.size(); ++i) {
+#ifndef NDEBUG
+            startupImageFilenames[i] = (string)"../" + IMAGE_FILENAMES[i];
+#else
+            startupImageFilenames[i] = IMAGE_FILENAMES[i];
+#endif
+            startupImages[i].filename = startupImageFilenames[i].c_str();
+            startupImages[i].encodedData = nullptr;
+            startupImages[i].encodedSize = 0;
+            startupImages[i].data = nullptr;
         }
     }
     static void CreateImGuiImages() {
+        auto startTime = std::chrono::steady_clock::now();
+
         // Get the font texture data
         int32_t width, height;
         void* data;
         ImGui::GetIO().Fonts->GetTexDataAsRGBA32((uint8_t**)&data, &width, &height);
 
-        // Create the font image
-        CreateImGuiImage((size_t)width, (size_t)height, data, fontDescriptorSet, fontImage, fontImageMemory, fontImageView);
+        // Register the font texture and set its ID
+        fontTexture = (ImGuiTexture*)RegisterImGuiTexture((size_t)width, (size_t)height, data);
+        ImGui::GetIO().Fonts->SetTexID((ImTextureID)fontTexture);
 
-        // Set the font texture ID
-        ImGui::GetIO().Fonts->SetTexID((ImTextureID)fontDescriptorSet);
+        // Decode every image, unless the startup tasks already did, and pack them into the icon atlas
+        PrepareStartupImages();
+        imageRegions.resize(IMAGE_FILENAMES.size());
 
-        // Load every other image
-        images.resize(IMAGE_FILENAMES.size());
-        imageMemories.resize(IMAGE_FILENAMES.size());
-        imageViews.resize(IMAGE_FILENAMES.size());
+        bool8_t decodedAhead = decodedStartupImageCount == startupImages.size();
+        if(!decodedAhead)
+            ParallelFor(startupImages.size(), DecodeImage, startupImages.data());
 
-        for(size_t i = 0; i < IMAGE_FILENAMES.size(); ++i) {
-            // Get the filename
-            string filename = IMAGE_FILENAMES[i];
-#ifndef NDEBUG
-            filename = (string)"../" + filename;
-#endif
+        auto decodeEndTime = std::chrono::steady_clock::now();
 
-            // Load the image
-            int32_t channels;
-            data = stbi_load(filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+        PackDecodedIcons(startupImages.size(), startupImages.data(), imageRegions.data());
 
-            // Create the image
-            CreateImGuiImage((size_t)width, (size_t)height, data, imageDescriptorSets[i], images[i], imageMemories[i], imageViews[i]);
+        startupImages.clear();
+        startupImageFilenames.clear();
+        decodedStartupImageCount = 0;
 
-            // Delete the data
-            free(data);
-        }
+        // Wait for the startup textures, so the first frame can be drawn with them
+        uint64_t lastUpload = fontTexture->pendingUpload;
+        for(const ImGuiTextureRegion& region : imageRegions)
+            if(region.textureId && ((ImGuiTexture*)region.textureId)->pendingUpload > lastUpload)
+                lastUpload = ((ImGuiTexture*)region.textureId)->pendingUpload;
+
+        SubmitUploads();
+        WaitForUpload(lastUpload);
+        SwapFinishedTextureUploads();
+
+        auto uploadEndTime = std::chrono::steady_clock::now();
+
+        // Log the time spent in each startup phase
+        float64_t decodeTime = std::chrono::duration<float64_t, std::milli>(decodeEndTime - startTime).count();
+        float64_t uploadTime = std::chrono::duration<float64_t, std::milli>(uploadEndTime - decodeEndTime).count();
+
+        if(decodedAhead)
+            console::OutMessageFunction((string)"Decoded " + ToString(IMAGE_FILENAMES.size()) + " images ahead of time.");
+        else
+            console::OutMessageFunction((string)"Decoded " + ToString(IMAGE_FILENAMES.size()) + " images in " + ToString(decodeTime) + " ms using " + ToString(GetWorkerThreadCount() + 1) + " threads.");
+        console::OutMessageFunction((string)"Packed " + ToString(IMAGE_FILENAMES.size()) + " icons into " + ToString(iconAtlasCount) + " atlas textures and uploaded them in " + ToString(uploadTime) + " ms.");
     }
-    static void CreatePipelineLayout() {
+    static void CreatePipelineLayout(VkDescriptorSetLayout descriptorSetLayout, VkPipelineLayout& pipelineLayout) {
         // Set the push constant range
         VkPushConstantRange pushConstantRange;
 
@@ -404,57 +1080,52 @@ namespace wfe::editor {
         createInfo.pNext = nullptr;
         createInfo.flags = 0;
         createInfo.setLayoutCount = 1;
-        createInfo.pSetLayouts = &fontDescriptorSetLayout;
+        createInfo.pSetLayouts = &descriptorSetLayout;
         createInfo.pushConstantRangeCount = 1;
         createInfo.pPushConstantRanges = &pushConstantRange;
 
-        auto result = vkCreatePipelineLayout(GetDevice(), &createInfo, GetVulkanAllocator(), &layout);
+        auto result = vkCreatePipelineLayout(GetDevice(), &createInfo, GetVulkanAllocator(), &pipelineLayout);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to create pipeline layout! Error code: " + VkResultToString(result), 1);
     }
-    static void CreateShaderModules() {
-        // Set the vertex shader module create info
-        VkShaderModuleCreateInfo vertShaderInfo;
-
-        vertShaderInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        vertShaderInfo.pNext = nullptr;
-        vertShaderInfo.flags = 0;
-        vertShaderInfo.codeSize = sizeof(VERT_SHADER_CODE);
-        vertShaderInfo.pCode = VERT_SHADER_CODE;
-
-        // Set the fragment shader module create info
-        VkShaderModuleCreateInfo fragShaderInfo;
-
-        fragShaderInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        fragShaderInfo.pNext = nullptr;
-        fragShaderInfo.flags = 0;
-        fragShaderInfo.codeSize = sizeof(FRAG_SHADER_CODE);
-        fragShaderInfo.pCode = FRAG_SHADER_CODE;
-
-        // Create the vertex shader module
-        auto result = vkCreateShaderModule(GetDevice(), &vertShaderInfo, GetVulkanAllocator(), &vertShaderModule);
-        if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to create vertex shader module! Error code: " + VkResultToString(result), 1);
-        
-        // Create the fragment shader module
-        result = vkCreateShaderModule(GetDevice(), &fragShaderInfo, GetVulkanAllocator(), &fragShaderModule);
+    static void CreateShaderModule(const uint32_t* code, size_t codeSize, VkShaderModule& shaderModule) {
+        // Set the shader module create info
+        VkShaderModuleCreateInfo createInfo;
+
+        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.codeSize = codeSize;
+        createInfo.pCode = code;
+
+        // Create the shader module
+        auto result = vkCreateShaderModule(GetDevice(), &createInfo, GetVulkanAllocator(), &shaderModule);
         if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to create fragment shader module! Error code: " + VkResultToString(result), 1);
+            console::OutFatalError((string)"Failed to create shader module! Error code: " + VkResultToString(result), 1);
+    }
+    static void CreateShaderModules() {
+        CreateShaderModule(VERT_SHADER_CODE, sizeof(VERT_SHADER_CODE), vertShaderModule);
+        CreateShaderModule(FRAG_SHADER_CODE, sizeof(FRAG_SHADER_CODE), fragShaderModule);
     }
-    static void CreateGraphicsPipeline() {
-        // Set the vertex binding description
-        VkVertexInputBindingDescription bindingDescription;
+    static void CreateGraphicsPipeline(bool8_t bindless, VkPipeline& graphicsPipeline) {
+        // Set the vertex binding descriptions; the bindless pipeline reads every vertex's texture index from a second buffer
+        VkVertexInputBindingDescription bindingDescriptions[2];
         
-        bindingDescription.binding = 0;
-        bindingDescription.stride = sizeof(ImDrawVert);
-        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        bindingDescriptions[0].binding = 0;
+        bindingDescriptions[0].stride = sizeof(ImDrawVert);
+        bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+        bindingDescriptions[1].binding = 1;
+        bindingDescriptions[1].stride = sizeof(uint32_t);
+        bindingDescriptions[1].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
 
         // Set the vertex attribute descriptions
-        VkVertexInputAttributeDescription attributeDescriptions[3];
+        VkVertexInputAttributeDescription attributeDescriptions[4];
 
         attributeDescriptions[0] = { 0, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(ImDrawVert, pos) };
         attributeDescriptions[1] = { 1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(ImDrawVert, uv) };
         attributeDescriptions[2] = { 2, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(ImDrawVert, col) };
+        attributeDescriptions[3] = { 3, 1, VK_FORMAT_R32_UINT, 0 };
 
         // Set the vertex input info
         VkPipelineVertexInputStateCreateInfo vertexInputInfo;
@@ -462,9 +1133,9 @@ namespace wfe::editor {
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
         vertexInputInfo.pNext = nullptr;
         vertexInputInfo.flags = 0;
-        vertexInputInfo.vertexBindingDescriptionCount = 1;
-        vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-        vertexInputInfo.vertexAttributeDescriptionCount = 3;
+        vertexInputInfo.vertexBindingDescriptionCount = bindless ? 2 : 1;
+        vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions;
+        vertexInputInfo.vertexAttributeDescriptionCount = bindless ? 4 : 3;
         vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions;
 
         // Set the input assembly info
@@ -587,6 +1258,15 @@ namespace wfe::editor {
         dynamicStateInfo.dynamicStateCount = 2;
         dynamicStateInfo.pDynamicStates = dynamicStates;
 
+        // Set the fragment shader specialization info, which sizes the bindless texture array
+        VkSpecializationMapEntry specializationEntry = { 0, 0, sizeof(uint32_t) };
+        VkSpecializationInfo specializationInfo;
+
+        specializationInfo.mapEntryCount = 1;
+        specializationInfo.pMapEntries = &specializationEntry;
+        specializationInfo.dataSize = sizeof(uint32_t);
+        specializationInfo.pData = &bindlessTextureCount;
+
         // Set the shader stages
         VkPipelineShaderStageCreateInfo shaderStages[2];
 
@@ -594,7 +1274,7 @@ namespace wfe::editor {
         shaderStages[0].pNext = nullptr;
         shaderStages[0].flags = 0;
         shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-        shaderStages[0].module = vertShaderModule;
+        shaderStages[0].module = bindless ? bindlessVertShaderModule : vertShaderModule;
         shaderStages[0].pName = "main";
         shaderStages[0].pSpecializationInfo = nullptr;
 
@@ -602,15 +1282,15 @@ namespace wfe::editor {
         shaderStages[1].pNext = nullptr;
         shaderStages[1].flags = 0;
         shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-        shaderStages[1].module = fragShaderModule;
+        shaderStages[1].module = bindless ? bindlessFragShaderModule : fragShaderModule;
         shaderStages[1].pName = "main";
-        shaderStages[1].pSpecializationInfo = nullptr;
+        shaderStages[1].pSpecializationInfo = bindless ? &specializationInfo : nullptr;
 
         // Set the graphics pipeline create info
         VkGraphicsPipelineCreateInfo createInfo;
 
         createInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        createInfo.pNext = nullptr;
+        createInfo.pNext = IsDynamicRenderingEnabled() ? GetPipelineRenderingCreateInfo() : nullptr;
         createInfo.flags = 0;
         createInfo.stageCount = 2;
         createInfo.pStages = shaderStages;
@@ -623,49 +1303,429 @@ namespace wfe::editor {
         createInfo.pDepthStencilState = &depthStencilInfo;
         createInfo.pColorBlendState = &colorBlendInfo;
         createInfo.pDynamicState = &dynamicStateInfo;
-        createInfo.layout = layout;
+        createInfo.layout = bindless ? bindlessLayout : layout;
         createInfo.renderPass = GetRenderPass();
         createInfo.subpass = 0;
         createInfo.basePipelineHandle = VK_NULL_HANDLE;
         createInfo.basePipelineIndex = -1;
 
         // Create the graphics pipeline
-        auto result = vkCreateGraphicsPipelines(GetDevice(), VK_NULL_HANDLE, 1, &createInfo, GetVulkanAllocator(), &pipeline);
+        auto result = vkCreateGraphicsPipelines(GetDevice(), GetPipelineCache(), 1, &createInfo, GetVulkanAllocator(), &graphicsPipeline);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to create graphics pipeline! Error code: " + VkResultToString(result), 1);
     }
 
+    static uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+        const char_t* bytes = (const char_t*)data;
+
+        // Hash the data one word at a time
+        for(; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+            uint64_t word;
+            memcpy(&word, bytes, sizeof(uint64_t));
+
+            hash = (hash ^ word) * FINGERPRINT_PRIME;
+        }
+
+        // Hash the remaining bytes
+        for(; size; --size, ++bytes)
+            hash = (hash ^ (uint8_t)*bytes) * FINGERPRINT_PRIME;
+        
+        return hash;
+    }
+    static uint64_t GetDrawDataFingerprint(ImDrawData* drawData) {
+        // Return the cached fingerprint if it was already computed this frame
+        if(currentFingerprintFrame == ImGui::GetFrameCount())
+            return currentFingerprint;
+        
+        // Hash the display parameters
+        uint64_t hash = FINGERPRINT_OFFSET_BASIS;
+
+        hash = HashBytes(hash, &drawData->DisplayPos, sizeof(ImVec2));
+        hash = HashBytes(hash, &drawData->DisplaySize, sizeof(ImVec2));
+        hash = HashBytes(hash, &drawData->FramebufferScale, sizeof(ImVec2));
+        hash = HashBytes(hash, &drawData->CmdListsCount, sizeof(int32_t));
+
+        // Hash every command list's geometry and commands
+        for(size_t i = 0; i < drawData->CmdListsCount; ++i) {
+            ImDrawList* cmdList = drawData->CmdLists[i];
+
+            hash = HashBytes(hash, &cmdList->VtxBuffer.Size, sizeof(int32_t));
+            hash = HashBytes(hash, cmdList->VtxBuffer.Data, cmdList->VtxBuffer.Size * sizeof(ImDrawVert));
+            hash = HashBytes(hash, &cmdList->IdxBuffer.Size, sizeof(int32_t));
+            hash = HashBytes(hash, cmdList->IdxBuffer.Data, cmdList->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+            for(size_t j = 0; j < cmdList->CmdBuffer.Size; ++j) {
+                ImDrawCmd* drawCmd = &cmdList->CmdBuffer[j];
+
+                hash = HashBytes(hash, &drawCmd->ClipRect, sizeof(ImVec4));
+                hash = HashBytes(hash, &drawCmd->TextureId, sizeof(ImTextureID));
+                hash = HashBytes(hash, &drawCmd->VtxOffset, sizeof(uint32_t));
+                hash = HashBytes(hash, &drawCmd->IdxOffset, sizeof(uint32_t));
+                hash = HashBytes(hash, &drawCmd->ElemCount, sizeof(uint32_t));
+            }
+        }
+
+        // Cache the fingerprint for the current frame
+        currentFingerprint = hash;
+        currentFingerprintFrame = ImGui::GetFrameCount();
+
+        return hash;
+    }
+    static bool8_t HasDrawCallbacks(ImDrawData* drawData) {
+        for(size_t i = 0; i < drawData->CmdListsCount; ++i) {
+            ImDrawList* cmdList = drawData->CmdLists[i];
+            for(size_t j = 0; j < cmdList->CmdBuffer.Size; ++j)
+                if(cmdList->CmdBuffer[j].UserCallback)
+                    return true;
+        }
+
+        return false;
+    }
+
+    static void BindRenderState(VkCommandBuffer commandBuffer, const GeometryBuffer& vertexBuffer, const GeometryBuffer& indexBuffer, const GeometryBuffer* textureIndexBuffer, DrawStateTracker& stateTracker) {
+        // Pick the bindless pipeline if a texture index buffer was given
+        VkPipeline boundPipeline = textureIndexBuffer ? bindlessPipeline : pipeline;
+        VkPipelineLayout boundLayout = textureIndexBuffer ? bindlessLayout : layout;
+
+        // Bind the pipeline
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, boundPipeline);
+
+        // Set the viewport
+        VkViewport viewport = { 0.f, 0.f, (float32_t)GetSwapChainWidth(), (float32_t)GetSwapChainHeight(), 0.f, 1.f };
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+
+        // Set the push constants
+        PushConstants pushConstants;
+        pushConstants.scale[0] = 2.f / GetSwapChainWidth();
+        pushConstants.scale[1] = 2.f / GetSwapChainHeight();
+
+        vkCmdPushConstants(commandBuffer, boundLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PushConstants), &pushConstants);
+
+        stats.stateChangeCount += 3;
+
+        // Bind the vertex and index buffers, unless nothing was ever drawn and they weren't created yet
+        if(vertexBuffer.buffer && indexBuffer.buffer && (!textureIndexBuffer || textureIndexBuffer->buffer)) {
+            VkBuffer vertexBuffers[] = { vertexBuffer.buffer, textureIndexBuffer ? textureIndexBuffer->buffer : VK_NULL_HANDLE };
+            VkDeviceSize offsets[] = { 0, 0 };
+
+            vkCmdBindVertexBuffers(commandBuffer, 0, textureIndexBuffer ? 2 : 1, vertexBuffers, offsets);
+            vkCmdBindIndexBuffer(commandBuffer, indexBuffer.buffer, 0, VK_INDEX_TYPE_UINT16);
+
+            stats.stateChangeCount += 2;
+        }
+
+        // Invalidate the tracked per draw state
+        stateTracker.descriptorSet = VK_NULL_HANDLE;
+        stateTracker.scissorSet = false;
+
+        // Bind the bindless texture array, which stays bound for the whole frame
+        if(textureIndexBuffer) {
+            VkDescriptorSet bindlessDescriptorSet = bindlessDescriptorSets[GetCurrentFrame()];
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bindlessLayout, 0, 1, &bindlessDescriptorSet, 0, nullptr);
+
+            stateTracker.descriptorSet = bindlessDescriptorSet;
+            ++stats.descriptorSetBindCount;
+            ++stats.stateChangeCount;
+        }
+    }
+    static bool8_t GetDrawCmdScissor(const ImDrawCmd* drawCmd, VkRect2D& scissor) {
+        // Clamp the clip rect to the framebuffer
+        int32_t minX = drawCmd->ClipRect.x < 0.f ? 0 : (int32_t)drawCmd->ClipRect.x;
+        int32_t minY = drawCmd->ClipRect.y < 0.f ? 0 : (int32_t)drawCmd->ClipRect.y;
+        int32_t maxX = drawCmd->ClipRect.z > (float32_t)GetSwapChainWidth() ? (int32_t)GetSwapChainWidth() : (int32_t)drawCmd->ClipRect.z;
+        int32_t maxY = drawCmd->ClipRect.w > (float32_t)GetSwapChainHeight() ? (int32_t)GetSwapChainHeight() : (int32_t)drawCmd->ClipRect.w;
+
+        // Return false if nothing is visible
+        if(maxX <= minX || maxY <= minY)
+            return false;
+        
+        scissor = { { minX, minY }, { (uint32_t)(maxX - minX), (uint32_t)(maxY - minY) } };
+        return true;
+    }
+    static bool8_t IsScissorChanged(const VkRect2D& scissor, const DrawStateTracker& stateTracker) {
+        return !stateTracker.scissorSet || memcmp(&scissor, &stateTracker.scissor, sizeof(VkRect2D));
+    }
+    static void SetScissor(VkCommandBuffer commandBuffer, const VkRect2D& scissor, DrawStateTracker& stateTracker) {
+        // Exit the function if the scissor didn't change
+        if(!IsScissorChanged(scissor, stateTracker))
+            return;
+        
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+
+        stateTracker.scissor = scissor;
+        stateTracker.scissorSet = true;
+        ++stats.scissorChangeCount;
+        ++stats.stateChangeCount;
+    }
+    static void BindTextureDescriptorSet(VkCommandBuffer commandBuffer, ImTextureID textureId, DrawStateTracker& stateTracker) {
+        // Exit the function if the texture's descriptor set is already bound
+        VkDescriptorSet descriptorSet = ((ImGuiTexture*)textureId)->resources.descriptorSet;
+        if(descriptorSet == stateTracker.descriptorSet)
+            return;
+        
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, &descriptorSet, 0, nullptr);
+
+        stateTracker.descriptorSet = descriptorSet;
+        ++stats.descriptorSetBindCount;
+        ++stats.stateChangeCount;
+    }
+    static uint32_t BeginDrawListGPUScope(VkCommandBuffer commandBuffer, const ImDrawList* cmdList) {
+        // Exit the function if windows aren't timed separately
+        if(!AreWindowGPUTimingsEnabled())
+            return INVALID_GPU_SCOPE;
+        
+        // Every window has its own draw list, named after the window
+        return BeginGPUScope(commandBuffer, cmdList->_OwnerName ? cmdList->_OwnerName : "Unnamed draw list");
+    }
+    static void RecordDrawCommands(VkCommandBuffer commandBuffer, ImDrawData* drawData, const GeometryBuffer& vertexBuffer, const GeometryBuffer& indexBuffer) {
+        // Bind the render state that stays the same for the whole frame
+        DrawStateTracker stateTracker;
+        BindRenderState(commandBuffer, vertexBuffer, indexBuffer, nullptr, stateTracker);
+
+        uint32_t vertOffset = 0, indOffset = 0;
+        for(size_t i = 0; i < drawData->CmdListsCount; ++i) {
+            ImDrawList* cmdList = drawData->CmdLists[i];
+            uint32_t windowScope = BeginDrawListGPUScope(commandBuffer, cmdList);
+
+            for(size_t j = 0; j < cmdList->CmdBuffer.Size; ++j) {
+                ImDrawCmd* drawCmd = &cmdList->CmdBuffer[j];
+                ++stats.drawCommandCount;
+                
+                if(drawCmd->UserCallback) {
+                    // Run the specified user callback
+                    if(drawCmd->UserCallback != ImDrawCallback_ResetRenderState)
+                        drawCmd->UserCallback(cmdList, drawCmd);
+                    
+                    // The callback might have changed any state, so bind everything again
+                    BindRenderState(commandBuffer, vertexBuffer, indexBuffer, nullptr, stateTracker);
+                } else {
+                    // Skip the command if nothing is visible or if its texture's upload isn't complete yet
+                    VkRect2D scissor;
+                    if(!GetDrawCmdScissor(drawCmd, scissor) || !IsTextureReady(drawCmd->TextureId))
+                        continue;
+
+                    // Set the scissor and bind the texture's descriptor set if they changed
+                    SetScissor(commandBuffer, scissor, stateTracker);
+                    BindTextureDescriptorSet(commandBuffer, drawCmd->TextureId, stateTracker);
+
+                    // Draw the UI elements
+                    vkCmdDrawIndexed(commandBuffer, drawCmd->ElemCount, 1, drawCmd->IdxOffset + indOffset, drawCmd->VtxOffset + vertOffset, 0);
+                    ++stats.drawCallCount;
+                }
+            }
+
+            EndGPUScope(commandBuffer, windowScope);
+
+            vertOffset += cmdList->VtxBuffer.Size;
+            indOffset += cmdList->IdxBuffer.Size;
+        }
+    }
+    static void WriteTextureIndices(ImDrawData* drawData, uint32_t* dstTextureIndices) {
+        for(size_t i = 0; i < drawData->CmdListsCount; ++i) {
+            ImDrawList* cmdList = drawData->CmdLists[i];
+            for(size_t j = 0; j < cmdList->CmdBuffer.Size; ++j) {
+                ImDrawCmd* drawCmd = &cmdList->CmdBuffer[j];
+                if(drawCmd->UserCallback)
+                    continue;
+                
+                // Textures outside the bindless array are drawn with their own descriptor set, so their index doesn't matter
+                uint32_t textureIndex = FindBindlessTextureIndex(drawCmd->TextureId);
+                if(textureIndex == INVALID_TEXTURE_INDEX)
+                    textureIndex = 0;
+                
+                // Set the texture index of every vertex referenced by the command
+                uint32_t* dstCmdTextureIndices = dstTextureIndices + drawCmd->VtxOffset;
+                const ImDrawIdx* indices = cmdList->IdxBuffer.Data + drawCmd->IdxOffset;
+
+                for(size_t k = 0; k < drawCmd->ElemCount; ++k)
+                    dstCmdTextureIndices[indices[k]] = textureIndex;
+            }
+
+            dstTextureIndices += cmdList->VtxBuffer.Size;
+        }
+    }
+    static void FlushPendingDraw(VkCommandBuffer commandBuffer, PendingDraw& pendingDraw) {
+        // Exit the function if there is nothing to draw
+        if(!pendingDraw.indexCount)
+            return;
+        
+        vkCmdDrawIndexed(commandBuffer, pendingDraw.indexCount, 1, pendingDraw.firstIndex, pendingDraw.vertexOffset, 0);
+        ++stats.drawCallCount;
+
+        pendingDraw.indexCount = 0;
+    }
+    static void RecordBindlessDrawCommands(VkCommandBuffer commandBuffer, ImDrawData* drawData, const GeometryBuffer& vertexBuffer, const GeometryBuffer& indexBuffer, const GeometryBuffer& textureIndexBuffer) {
+        // Bind the render state that stays the same for the whole frame
+        DrawStateTracker stateTracker;
+        BindRenderState(commandBuffer, vertexBuffer, indexBuffer, &textureIndexBuffer, stateTracker);
+
+        // Consecutive commands are merged into one pending draw for as long as possible
+        PendingDraw pendingDraw;
+        pendingDraw.indexCount = 0;
+
+        uint32_t vertOffset = 0, indOffset = 0;
+        for(size_t i = 0; i < drawData->CmdListsCount; ++i) {
+            ImDrawList* cmdList = drawData->CmdLists[i];
+
+            // Draws can't be merged across windows that are timed separately
+            if(AreWindowGPUTimingsEnabled())
+                FlushPendingDraw(commandBuffer, pendingDraw);
+            uint32_t windowScope = BeginDrawListGPUScope(commandBuffer, cmdList);
+
+            for(size_t j = 0; j < cmdList->CmdBuffer.Size; ++j) {
+                ImDrawCmd* drawCmd = &cmdList->CmdBuffer[j];
+                ++stats.drawCommandCount;
+                
+                if(drawCmd->UserCallback) {
+                    // Draw everything recorded before the callback
+                    FlushPendingDraw(commandBuffer, pendingDraw);
+
+                    // Run the specified user callback
+                    if(drawCmd->UserCallback != ImDrawCallback_ResetRenderState)
+                        drawCmd->UserCallback(cmdList, drawCmd);
+                    
+                    // The callback might have changed any state, so bind everything again
+                    BindRenderState(commandBuffer, vertexBuffer, indexBuffer, &textureIndexBuffer, stateTracker);
+                    continue;
+                }
+
+                // Skip the command if nothing is visible or if its texture's upload isn't complete yet
+                VkRect2D scissor;
+                if(!GetDrawCmdScissor(drawCmd, scissor) || !IsTextureReady(drawCmd->TextureId))
+                    continue;
+                
+                uint32_t textureIndex = FindBindlessTextureIndex(drawCmd->TextureId);
+                uint32_t firstIndex = drawCmd->IdxOffset + indOffset;
+                int32_t vertexOffset = (int32_t)(drawCmd->VtxOffset + vertOffset);
+
+                // Merge the command into the pending draw if it continues its index range with the same scissor. 
+                // Different textures can only be merged if they can be indexed non-uniformly
+                bool8_t scissorChanged = IsScissorChanged(scissor, stateTracker);
+
+                if(pendingDraw.indexCount && !scissorChanged && textureIndex != INVALID_TEXTURE_INDEX && pendingDraw.firstIndex + pendingDraw.indexCount == firstIndex && pendingDraw.vertexOffset == vertexOffset && (bindlessNonUniform || pendingDraw.textureIndex == textureIndex)) {
+                    pendingDraw.indexCount += drawCmd->ElemCount;
+                    continue;
+                }
+
+                // Draw the pending commands
+                FlushPendingDraw(commandBuffer, pendingDraw);
+
+                if(textureIndex == INVALID_TEXTURE_INDEX) {
+                    // The texture isn't in the bindless array; draw it with its own descriptor set using the regular pipeline
+                    BindRenderState(commandBuffer, vertexBuffer, indexBuffer, nullptr, stateTracker);
+                    SetScissor(commandBuffer, scissor, stateTracker);
+                    BindTextureDescriptorSet(commandBuffer, drawCmd->TextureId, stateTracker);
+
+                    vkCmdDrawIndexed(commandBuffer, drawCmd->ElemCount, 1, firstIndex, vertexOffset, 0);
+                    ++stats.drawCallCount;
+
+                    BindRenderState(commandBuffer, vertexBuffer, indexBuffer, &textureIndexBuffer, stateTracker);
+                    continue;
+                }
+
+                // Start a new pending draw
+                SetScissor(commandBuffer, scissor, stateTracker);
+
+                pendingDraw.indexCount = drawCmd->ElemCount;
+                pendingDraw.firstIndex = firstIndex;
+                pendingDraw.vertexOffset = vertexOffset;
+                pendingDraw.textureIndex = textureIndex;
+            }
+
+            // Draw the window's last pending commands inside its scope
+            if(windowScope != INVALID_GPU_SCOPE) {
+                FlushPendingDraw(commandBuffer, pendingDraw);
+                EndGPUScope(commandBuffer, windowScope);
+            }
+
+            vertOffset += cmdList->VtxBuffer.Size;
+            indOffset += cmdList->IdxBuffer.Size;
+        }
+
+        // Draw the last pending commands
+        FlushPendingDraw(commandBuffer, pendingDraw);
+    }
+
     // Public functions
+    size_t GetStartupImageCount() {
+        PrepareStartupImages();
+        return startupImages.size();
+    }
+    void DecodeStartupImage(size_t index) {
+        DecodeImage(index, startupImages.data());
+        ++decodedStartupImageCount;
+    }
     void CreateImGuiPipeline() {
+        CheckBindlessSupport();
         CreateSampler();
-        CreateDescriptorPool();
-        CreateFontDescriptorSets();
+        CreateTextureDescriptorSetLayout();
+        if(bindlessEnabled)
+            CreateBindlessDescriptorSet();
         CreateImGuiImages();
-        CreatePipelineLayout();
+        CreatePipelineLayout(textureDescriptorSetLayout, layout);
         CreateShaderModules();
-        CreateGraphicsPipeline();
+        CreateGraphicsPipeline(false, pipeline);
+
+        if(bindlessEnabled) {
+            CreatePipelineLayout(bindlessDescriptorSetLayout, bindlessLayout);
+            CreateShaderModule(BINDLESS_VERT_SHADER_CODE, sizeof(BINDLESS_VERT_SHADER_CODE), bindlessVertShaderModule);
+            if(bindlessNonUniform)
+                CreateShaderModule(BINDLESS_NON_UNIFORM_FRAG_SHADER_CODE, sizeof(BINDLESS_NON_UNIFORM_FRAG_SHADER_CODE), bindlessFragShaderModule);
+            else
+                CreateShaderModule(BINDLESS_FRAG_SHADER_CODE, sizeof(BINDLESS_FRAG_SHADER_CODE), bindlessFragShaderModule);
+            CreateGraphicsPipeline(true, bindlessPipeline);
+        }
 
         console::OutMessageFunction("Created ImGui graphics pipeline successfully.");
     }
     void DeleteImGuiPipeline() {
-        vkDeviceWaitIdle(GetDevice());
+        WaitForDeviceIdle();
         vkDestroyPipeline(GetDevice(), pipeline, GetVulkanAllocator());
         vkDestroyShaderModule(GetDevice(), vertShaderModule, GetVulkanAllocator());
         vkDestroyShaderModule(GetDevice(), fragShaderModule, GetVulkanAllocator());
         vkDestroyPipelineLayout(GetDevice(), layout, GetVulkanAllocator());
 
-        vkDestroyImage(GetDevice(), fontImage, GetVulkanAllocator());
-        vkFreeMemory(GetDevice(), fontImageMemory, GetVulkanAllocator());
-        vkDestroyImageView(GetDevice(), fontImageView, GetVulkanAllocator());
+        if(bindlessEnabled) {
+            vkDestroyPipeline(GetDevice(), bindlessPipeline, GetVulkanAllocator());
+            vkDestroyShaderModule(GetDevice(), bindlessVertShaderModule, GetVulkanAllocator());
+            vkDestroyShaderModule(GetDevice(), bindlessFragShaderModule, GetVulkanAllocator());
+            vkDestroyPipelineLayout(GetDevice(), bindlessLayout, GetVulkanAllocator());
+            vkDestroyDescriptorSetLayout(GetDevice(), bindlessDescriptorSetLayout, GetVulkanAllocator());
+            vkDestroyDescriptorPool(GetDevice(), bindlessDescriptorPool, GetVulkanAllocator());
+        }
 
-        for(size_t i = 0; i < images.size(); ++i) {
-            vkDestroyImage(GetDevice(), images[i], GetVulkanAllocator());
-            vkFreeMemory(GetDevice(), imageMemories[i], GetVulkanAllocator());
-            vkDestroyImageView(GetDevice(), imageViews[i], GetVulkanAllocator());
-        } 
+        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
+            DestroyGeometryBuffer(vertexBuffers[i]);
+            DestroyGeometryBuffer(indexBuffers[i]);
+            DestroyGeometryBuffer(textureIndexBuffers[i]);
+        }
+
+        // Destroy every texture, including the ones that were never released
+        for(RetiredTexture& retiredTexture : retiredTextures)
+            DestroyTextureResources(retiredTexture.resources);
+        retiredTextures.clear();
+        DeleteReleasedTextures();
+
+        for(ImGuiTexture* texture : textures) {
+            if(texture->ready)
+                DestroyTextureResources(texture->resources);
+            if(texture->pendingUpload)
+                DestroyTextureResources(texture->pendingResources);
+            delete texture;
+        }
+        pendingTextureCount = 0;
+        textures.clear();
+        imageRegions.clear();
+        iconAtlasCount = 0;
+
+        // Free the deferred descriptor sets before their pools are destroyed
+        DestroyDeferredResources();
 
-        vkDestroyDescriptorSetLayout(GetDevice(), fontDescriptorSetLayout, GetVulkanAllocator());
-        vkDestroyDescriptorPool(GetDevice(), descriptorPool, GetVulkanAllocator());
+        for(VkDescriptorPool descriptorPool : textureDescriptorPools)
+            vkDestroyDescriptorPool(GetDevice(), descriptorPool, GetVulkanAllocator());
+        textureDescriptorPools.clear();
+
+        vkDestroyDescriptorSetLayout(GetDevice(), textureDescriptorSetLayout, GetVulkanAllocator());
         vkDestroySampler(GetDevice(), sampler, GetVulkanAllocator());
 
         console::OutMessageFunction("Deleted ImGui graphics pipeline successfully.");
@@ -674,31 +1734,35 @@ namespace wfe::editor {
         // Acquire the next swap chain image
         uint32_t imageIndex;
         auto result = AcquireNextImage(&imageIndex);
-        if(result == VK_ERROR_OUT_OF_DATE_KHR)
+        if(result == VK_ERROR_OUT_OF_DATE_KHR) {
+            redrawRequested = true;
             return;
+        }
         if(result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
             console::OutFatalError((string)"Failed to acquire next swap chain image! Error code: " + VkResultToString(result), 1);
 
+        // Refresh this frame's bindless texture array
+        if(bindlessEnabled)
+            UpdateBindlessDescriptorSet();
+
         // Get the ImGui draw data
         ImDrawData* drawData = ImGui::GetDrawData();
 
-        VkBuffer vertexBuffer, indexBuffer;
-        VkDeviceMemory vertexBufferMemory, indexBufferMemory;
+        // Get the current frame's geometry buffers
+        GeometryBuffer& vertexBuffer = vertexBuffers[GetCurrentFrame()];
+        GeometryBuffer& indexBuffer = indexBuffers[GetCurrentFrame()];
 
         if(drawData->TotalVtxCount) {
-            // Create the vertex and index buffers
+            // Make sure the vertex and index buffers can fit the draw data
             VkDeviceSize vertexBufferSize = PadUniformBufferSize(drawData->TotalVtxCount * sizeof(ImDrawVert));
             VkDeviceSize indexBufferSize = PadUniformBufferSize(drawData->TotalIdxCount * sizeof(ImDrawIdx));
 
-            CreateBuffer(vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, vertexBuffer, vertexBufferMemory);
-            CreateBuffer(indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, indexBuffer, indexBufferMemory);
+            ReserveGeometryBuffer(vertexBuffer, vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, stats.vertexBufferCapacity);
+            ReserveGeometryBuffer(indexBuffer, indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, stats.indexBufferCapacity);
 
             // Write to the vertex and index buffers
-            ImDrawVert* dstVert;
-            ImDrawIdx* dstInd;
-
-            vkMapMemory(GetDevice(), vertexBufferMemory, 0, vertexBufferSize, 0, (void**)&dstVert);
-            vkMapMemory(GetDevice(), indexBufferMemory, 0, indexBufferSize, 0, (void**)&dstInd);
+            ImDrawVert* dstVert = (ImDrawVert*)vertexBuffer.mappedMemory;
+            ImDrawIdx* dstInd = (ImDrawIdx*)indexBuffer.mappedMemory;
 
             for(size_t i = 0; i < drawData->CmdListsCount; ++i) {
                 memcpy(dstVert, drawData->CmdLists[i]->VtxBuffer.Data, drawData->CmdLists[i]->VtxBuffer.Size * sizeof(ImDrawVert));
@@ -708,125 +1772,65 @@ namespace wfe::editor {
                 dstInd += drawData->CmdLists[i]->IdxBuffer.Size;
             }
 
-            // Flush the changes and unmap the buffers
-            VkMappedMemoryRange ranges[2];
+            // Write every vertex's texture index for the bindless pipeline
+            GeometryBuffer& textureIndexBuffer = textureIndexBuffers[GetCurrentFrame()];
+            VkDeviceSize textureIndexBufferSize = PadUniformBufferSize(drawData->TotalVtxCount * sizeof(uint32_t));
 
-            ranges[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-            ranges[0].pNext = nullptr;
-            ranges[0].memory = vertexBufferMemory;
-            ranges[0].offset = 0;
-            ranges[0].size = vertexBufferSize;
-
-            ranges[1].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-            ranges[1].pNext = nullptr;
-            ranges[1].memory = indexBufferMemory;
-            ranges[1].offset = 0;
-            ranges[1].size = indexBufferSize;
-
-            vkFlushMappedMemoryRanges(GetDevice(), 2, ranges);
+            if(bindlessEnabled) {
+                ReserveGeometryBuffer(textureIndexBuffer, textureIndexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, stats.textureIndexBufferCapacity);
+                WriteTextureIndices(drawData, (uint32_t*)textureIndexBuffer.mappedMemory);
+            }
 
-            vkUnmapMemory(GetDevice(), vertexBufferMemory);
-            vkUnmapMemory(GetDevice(), indexBufferMemory);
+            // Flush the written ranges
+            FlushMemory(vertexBuffer.allocation, 0, vertexBufferSize);
+            FlushMemory(indexBuffer.allocation, 0, indexBufferSize);
+            if(bindlessEnabled)
+                FlushMemory(textureIndexBuffer.allocation, 0, textureIndexBufferSize);
         }
 
-        // Allocate the command buffers
-        VkCommandBufferAllocateInfo allocInfo;
+        // Get a recycled command buffer from the current frame's command pool
+        VkCommandBuffer commandBuffer = AllocateFrameCommandBuffer(GetCurrentFrame());
+        commandBuffers[GetCurrentFrame()] = commandBuffer;
 
-        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.pNext = nullptr;
-        allocInfo.commandPool = GetCommandPool();
-        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandBufferCount = 1;
-
-        result = vkAllocateCommandBuffers(GetDevice(), &allocInfo, &commandBuffer);
-        if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to allocate command buffers! Error code: " + VkResultToString(result), 1);
-        
         // Begin recording the command buffer
         VkCommandBufferBeginInfo beginInfo;
 
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.pNext = nullptr;
-        beginInfo.flags = 0;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         beginInfo.pInheritanceInfo = nullptr;
 
         result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to begin recording command buffer! Error code: " + VkResultToString(result), 1);
 
+        // Read back an earlier frame's GPU timings and start timing this one
+        BeginGPUTimingFrame(commandBuffer);
+
         // Set the clear values
         VkClearValue clearValues[2];
         clearValues[0] = { 0.f, 0.f, 0.f, 1.f };
         clearValues[1] = { 1.f, 0 };
 
-        // Begin the render pass
-        VkRenderPassBeginInfo renderPassInfo;
-
-        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.pNext = nullptr;
-        renderPassInfo.renderPass = GetRenderPass();
-        renderPassInfo.framebuffer = GetFrameBuffer(imageIndex);
-        renderPassInfo.renderArea = { { 0, 0 }, GetSwapChainExtent() };
-        renderPassInfo.clearValueCount = 2;
-        renderPassInfo.pClearValues = clearValues;
+        // Begin rendering to the swap chain image
+        BeginSwapChainRendering(commandBuffer, imageIndex, clearValues);
 
-        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        // Reset the per frame stats
+        stats.drawCommandCount = 0;
+        stats.drawCallCount = 0;
+        stats.stateChangeCount = 0;
+        stats.descriptorSetBindCount = 0;
+        stats.scissorChangeCount = 0;
 
-        // Create the viewport
-        VkViewport viewport = { 0.f, 0.f, (float32_t)GetSwapChainWidth(), (float32_t)GetSwapChainHeight(), 0.f, 1.f };
-        
-        // Set the push constants
-        PushConstants pushConstants;
-        pushConstants.scale[0] = 2.f / GetSwapChainWidth();
-        pushConstants.scale[1] = 2.f / GetSwapChainHeight();
+        // Record the draw commands
+        if(bindlessEnabled)
+            RecordBindlessDrawCommands(commandBuffer, drawData, vertexBuffer, indexBuffer, textureIndexBuffers[GetCurrentFrame()]);
+        else
+            RecordDrawCommands(commandBuffer, drawData, vertexBuffer, indexBuffer);
 
-        vkCmdPushConstants(commandBuffer, layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PushConstants), &pushConstants);
-
-        VkDeviceSize vertOffset = 0, indOffset = 0;
-        for(size_t i = 0; i < drawData->CmdListsCount; ++i) {
-            ImDrawList* cmdList = drawData->CmdLists[i];
-            for(size_t j = 0; j < cmdList->CmdBuffer.Size; ++j) {
-                ImDrawCmd* drawCmd = &cmdList->CmdBuffer[j];
-                
-                if(drawCmd->UserCallback) {
-                    // Run the specified user callback
-                    if(drawCmd->UserCallback != ImDrawCallback_ResetRenderState)
-                        drawCmd->UserCallback(cmdList, drawCmd);
-                } else {
-                    // Bind the pipeline
-                    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-
-                    // Set the viewport
-                    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
-
-                    // Set the scissor
-                    VkRect2D scissor = { { (int32_t)drawCmd->ClipRect.x, (int32_t)drawCmd->ClipRect.y }, { (uint32_t)drawCmd->ClipRect.z - (uint32_t)drawCmd->ClipRect.x, (uint32_t)drawCmd->ClipRect.w - (uint32_t)drawCmd->ClipRect.y } };
-                    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
-
-                    // Push constants
-                    vkCmdPushConstants(commandBuffer, layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PushConstants), &pushConstants);
-
-                    // Bind the font descriptor set
-                    VkDescriptorSet descriptorSet = (VkDescriptorSet)drawCmd->TextureId;
-
-                    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, &descriptorSet, 0, nullptr);
-
-                    // Bind the vertex and index buffers
-                    VkDeviceSize offset = 0;
-                    vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vertexBuffer, &offset);
-                    vkCmdBindIndexBuffer(commandBuffer, indexBuffer, offset, VK_INDEX_TYPE_UINT16);
-
-                    // Draw the UI elements
-                    vkCmdDrawIndexed(commandBuffer, drawCmd->ElemCount, 1, drawCmd->IdxOffset + indOffset, drawCmd->VtxOffset + vertOffset, 0);
-                }
-            }
-
-            vertOffset += cmdList->VtxBuffer.Size;
-            indOffset += cmdList->IdxBuffer.Size;
-        }
-
-        // End the render pass
-        vkCmdEndRenderPass(commandBuffer);
+        // End rendering to the swap chain image
+        EndSwapChainRendering(commandBuffer, imageIndex);
+        EndGPUTimingFrame(commandBuffer);
 
         // End recording the command buffer
         result = vkEndCommandBuffer(commandBuffer);
@@ -838,16 +1842,63 @@ namespace wfe::editor {
         if(result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR && result != VK_ERROR_OUT_OF_DATE_KHR)
             console::OutFatalError((string)"Failed to submit command buffer! Error code: " + VkResultToString(result), 1);
         
-        vkDeviceWaitIdle(GetDevice());
-        vkFreeCommandBuffers(GetDevice(), GetCommandPool(), 1, &commandBuffer);
-
-        if(drawData->TotalVtxCount) {
-            // Destroy the vertex and index buffers
-            vkDestroyBuffer(GetDevice(), vertexBuffer, GetVulkanAllocator());
-            vkDestroyBuffer(GetDevice(), indexBuffer, GetVulkanAllocator());
-            vkFreeMemory(GetDevice(), vertexBufferMemory, GetVulkanAllocator());
-            vkFreeMemory(GetDevice(), indexBufferMemory, GetVulkanAllocator());
+        // Remember what was presented, unless the swap chain went out of date and the frame has to be drawn again
+        if(result == VK_ERROR_OUT_OF_DATE_KHR) {
+            redrawRequested = true;
+        } else {
+            if(presentOnChange)
+                lastPresentedFingerprint = GetDrawDataFingerprint(drawData);
+            redrawRequested = false;
         }
+
+        ++stats.presentedFrameCount;
+
+        // Delete the records of the textures released before this frame was recorded
+        DeleteReleasedTextures();
+    }
+    bool8_t HasImGuiFrameChanged() {
+        // Swap in the textures whose uploads finished, which requests a redraw, and defer the destruction of the retired ones
+        SwapFinishedTextureUploads();
+        DeferRetiredTextures();
+
+        // Every frame has to be drawn if present on change is disabled or if a redraw was requested
+        if(!presentOnChange || redrawRequested)
+            return true;
+        
+        // User callbacks might draw anything, so their output can't be fingerprinted
+        ImDrawData* drawData = ImGui::GetDrawData();
+        if(HasDrawCallbacks(drawData))
+            return true;
+        
+        // Compare the draw data's fingerprint with the last presented one
+        if(GetDrawDataFingerprint(drawData) != lastPresentedFingerprint)
+            return true;
+        
+        ++stats.skippedFrameCount;
+        return false;
+    }
+    void RequestRedraw() {
+        redrawRequested = true;
+    }
+
+    bool8_t IsBindlessRenderingEnabled() {
+        return bindlessEnabled;
+    }
+    void EnableBindlessRendering() {
+        bindlessRequested = true;
+    }
+    void DisableBindlessRendering() {
+        bindlessRequested = false;
+    }
+
+    bool8_t IsPresentOnChangeEnabled() {
+        return presentOnChange;
+    }
+    void EnablePresentOnChange() {
+        presentOnChange = true;
+    }
+    void DisablePresentOnChange() {
+        presentOnChange = false;
     }
 
     VkPipeline GetImGuiPipeline() {
@@ -857,10 +1908,101 @@ namespace wfe::editor {
         return layout;
     }
     VkCommandBuffer GetImGuiCommandBuffer() {
-        return commandBuffer;
+        return commandBuffers[GetCurrentFrame()];
     }
+    const ImGuiPipelineStats& GetImGuiPipelineStats() {
+        return stats;
+    }
+
+    ImGuiTextureRegion GetImGuiTexture(ImageID imageId) {
+        return imageRegions[imageId];
+    }
+    void LoadImGuiIcons(size_t count, const char_t* const* filenames, ImGuiTextureRegion* regions) {
+        // Set the decoded icons' sources
+        vector<DecodedImage> decodedImages(count);
+        for(size_t i = 0; i < count; ++i) {
+            decodedImages[i].filename = filenames[i];
+            decodedImages[i].data = nullptr;
+        }
+
+        // Decode every icon on the worker threads, then pack them into new atlases
+        ParallelFor(count, DecodeImage, decodedImages.data());
+        PackDecodedIcons(count, decodedImages.data(), regions);
+    }
+    ImTextureID RegisterImGuiTexture(size_t width, size_t height, const void* data) {
+        // Create the texture; it isn't drawn until its upload is complete
+        ImGuiTexture* texture = new ImGuiTexture;
+
+        texture->pendingResources.width = (uint32_t)width;
+        texture->pendingResources.height = (uint32_t)height;
+        texture->pendingUpload = CreateTextureResources(texture->pendingResources, data);
+        texture->ready = false;
+        texture->bindlessIndex = INVALID_TEXTURE_INDEX;
+        
+        textures.push_back(texture);
+        ++pendingTextureCount;
+
+        return (ImTextureID)texture;
+    }
+    void LoadImGuiTextures(size_t count, const char_t* const* filenames, ImTextureID* textureIds) {
+        // Set the decoded images' sources
+        vector<DecodedImage> decodedImages(count);
+        for(size_t i = 0; i < count; ++i) {
+            decodedImages[i].filename = filenames[i];
+            decodedImages[i].data = nullptr;
+        }
+
+        LoadDecodedImages(count, decodedImages.data(), textureIds);
+    }
+    void LoadImGuiTexturesFromMemory(size_t count, const void* const* encodedData, const size_t* encodedSizes, ImTextureID* textureIds) {
+        // Set the decoded images' sources
+        vector<DecodedImage> decodedImages(count);
+        for(size_t i = 0; i < count; ++i) {
+            decodedImages[i].filename = nullptr;
+            decodedImages[i].encodedData = encodedData[i];
+            decodedImages[i].encodedSize = encodedSizes[i];
+            decodedImages[i].data = nullptr;
+        }
+
+        LoadDecodedImages(count, decodedImages.data(), textureIds);
+    }
+    void UpdateImGuiTexture(ImTextureID textureId, size_t width, size_t height, const void* data) {
+        ImGuiTexture* texture = (ImGuiTexture*)textureId;
+
+        // Retire the previous pending contents, if their upload didn't finish yet
+        if(texture->pendingUpload)
+            RetireTexture(texture->pendingResources, texture->pendingUpload);
+        else
+            ++pendingTextureCount;
+
+        // Upload the new contents to new resources, so frames in flight can keep sampling the current ones. 
+        // They are swapped in once the upload is complete; the texture's ID stays the same
+        texture->pendingResources.width = (uint32_t)width;
+        texture->pendingResources.height = (uint32_t)height;
+        texture->pendingUpload = CreateTextureResources(texture->pendingResources, data);
+    }
+    void ReleaseImGuiTexture(ImTextureID textureId) {
+        ImGuiTexture* texture = (ImGuiTexture*)textureId;
+
+        // Remove the texture from the list of live textures
+        for(size_t i = 0; i < textures.size(); ++i)
+            if(textures[i] == texture) {
+                textures[i] = textures.back();
+                textures.pop_back();
+                break;
+            }
+        
+        // Retire the texture's pending contents, if they exist
+        if(texture->pendingUpload) {
+            RetireTexture(texture->pendingResources, texture->pendingUpload);
+            --pendingTextureCount;
+        }
 
-    ImTextureID GetImGuiTexture(ImageID imageId) {
-        return (ImTextureID)imageDescriptorSets[imageId];
+        // Free the texture's bindless slot and retire it. The current frame's draw data might still reference the record,
+        // so it is deleted once the next frame is recorded
+        FreeBindlessSlot(texture);
+        if(texture->ready)
+            RetireTexture(texture->resources, 0);
+        releasedTextures.push_back(texture);
     }
 }
\ No newline at end of file
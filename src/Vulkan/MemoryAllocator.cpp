@@ -0,0 +1,335 @@
+#include "Vulkan/MemoryAllocator.hpp"
+#include "Vulkan/Device.hpp"
+
+#include <mutex>
+
+namespace wfe::editor {
+    // Constants
+    const VkDeviceSize DEFAULT_MEMORY_BLOCK_SIZE = 67108864; // The size of every memory block, unless its heap is small
+    const VkDeviceSize MIN_MEMORY_BLOCK_SIZE = 1048576;      // The smallest memory block size used for small heaps
+    const VkDeviceSize SMALL_HEAP_SIZE = 536870912;          // Heaps at most this large get blocks of an eighth of their size
+    const VkDeviceSize MIN_MEMORY_NODE_SIZE = 256;           // The smallest range a block is split into; at least the largest allowed non coherent atom size
+    const uint32_t MAX_MEMORY_BLOCK_ORDER_COUNT = 32;
+
+    // Structs
+    struct MemoryBlock {
+        VkDeviceMemory memory;
+        VkDeviceSize size;
+        uint8_t* mappedMemory;
+        uint32_t memoryTypeIndex;
+        bool8_t linear;
+
+        uint32_t orderCount;
+        vector<VkDeviceSize> freeNodes[MAX_MEMORY_BLOCK_ORDER_COUNT]; // The offsets of the free ranges of every order; a range of order n is MIN_MEMORY_NODE_SIZE << n bytes long
+        size_t allocationCount;
+        VkDeviceSize usedSize;
+    };
+
+    // Variables
+    VkPhysicalDeviceMemoryProperties allocatorMemoryProperties;
+    VkDeviceSize memoryBlockSizes[VK_MAX_MEMORY_TYPES];
+    VkDeviceSize allocatorAtomSize;
+
+    std::mutex memoryAllocatorMutex;
+    vector<MemoryBlock*> memoryBlocks;
+    MemoryAllocatorStats memoryAllocatorStats{};
+
+    // Internal helper functions
+    static VkDeviceSize RoundUpToPowerOfTwo(VkDeviceSize value) {
+        VkDeviceSize result = 1;
+        while(result < value)
+            result <<= 1;
+        return result;
+    }
+    static uint32_t GetNodeOrder(VkDeviceSize size) {
+        uint32_t order = 0;
+        while((MIN_MEMORY_NODE_SIZE << order) < size)
+            ++order;
+        return order;
+    }
+    static void* AllocateDeviceMemory(VkDeviceSize size, uint32_t memoryTypeIndex, VkDeviceMemory& memory) {
+        // Set the memory allocate info
+        VkMemoryAllocateInfo allocInfo;
+
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext = nullptr;
+        allocInfo.allocationSize = size;
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+        // Allocate the memory
+        auto result = vkAllocateMemory(GetDevice(), &allocInfo, GetVulkanAllocator(), &memory);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to allocate device memory! Error code: " + VkResultToString(result), 1);
+
+        ++memoryAllocatorStats.deviceAllocationCount;
+
+        // Keep host visible memory mapped for its entire lifetime
+        if(!(allocatorMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+            return nullptr;
+
+        void* mappedMemory;
+        result = vkMapMemory(GetDevice(), memory, 0, VK_WHOLE_SIZE, 0, &mappedMemory);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to map device memory! Error code: " + VkResultToString(result), 1);
+
+        return mappedMemory;
+    }
+    static void FreeDeviceMemory(VkDeviceMemory memory) {
+        // Freeing the memory also unmaps it
+        vkFreeMemory(GetDevice(), memory, GetVulkanAllocator());
+        --memoryAllocatorStats.deviceAllocationCount;
+    }
+    static MemoryBlock* CreateMemoryBlock(uint32_t memoryTypeIndex, bool8_t linear) {
+        MemoryBlock* block = new MemoryBlock();
+
+        block->size = memoryBlockSizes[memoryTypeIndex];
+        block->mappedMemory = (uint8_t*)AllocateDeviceMemory(block->size, memoryTypeIndex, block->memory);
+        block->memoryTypeIndex = memoryTypeIndex;
+        block->linear = linear;
+        block->orderCount = GetNodeOrder(block->size) + 1;
+        block->allocationCount = 0;
+        block->usedSize = 0;
+
+        // The whole block starts out as a single free range
+        block->freeNodes[block->orderCount - 1].push_back(0);
+
+        memoryBlocks.push_back(block);
+        ++memoryAllocatorStats.blockCount;
+        memoryAllocatorStats.blockSize += block->size;
+
+        return block;
+    }
+    static void DestroyMemoryBlock(MemoryBlock* block) {
+        FreeDeviceMemory(block->memory);
+
+        --memoryAllocatorStats.blockCount;
+        memoryAllocatorStats.blockSize -= block->size;
+
+        delete block;
+    }
+    static bool8_t AllocateFromBlock(MemoryBlock* block, uint32_t order, VkDeviceSize& offset) {
+        // Find the smallest free range that fits the allocation
+        uint32_t freeOrder = order;
+        while(freeOrder < block->orderCount && block->freeNodes[freeOrder].empty())
+            ++freeOrder;
+
+        if(freeOrder == block->orderCount)
+            return false;
+
+        offset = block->freeNodes[freeOrder].back();
+        block->freeNodes[freeOrder].pop_back();
+
+        // Split the range in halves until it's the requested size, freeing the upper half every time
+        while(freeOrder > order) {
+            --freeOrder;
+            block->freeNodes[freeOrder].push_back(offset + (MIN_MEMORY_NODE_SIZE << freeOrder));
+        }
+
+        ++block->allocationCount;
+        block->usedSize += MIN_MEMORY_NODE_SIZE << order;
+
+        return true;
+    }
+    static void FreeFromBlock(MemoryBlock* block, VkDeviceSize offset, uint32_t order) {
+        --block->allocationCount;
+        block->usedSize -= MIN_MEMORY_NODE_SIZE << order;
+
+        // Merge the range with its buddy as long as the buddy is free
+        for(; order + 1 < block->orderCount; ++order) {
+            VkDeviceSize buddyOffset = offset ^ (MIN_MEMORY_NODE_SIZE << order);
+            vector<VkDeviceSize>& freeNodes = block->freeNodes[order];
+
+            size_t buddyIndex = 0;
+            while(buddyIndex < freeNodes.size() && freeNodes[buddyIndex] != buddyOffset)
+                ++buddyIndex;
+
+            if(buddyIndex == freeNodes.size())
+                break;
+
+            freeNodes[buddyIndex] = freeNodes.back();
+            freeNodes.pop_back();
+
+            if(buddyOffset < offset)
+                offset = buddyOffset;
+        }
+
+        block->freeNodes[order].push_back(offset);
+    }
+
+    // Public functions
+    void CreateMemoryAllocator() {
+        vkGetPhysicalDeviceMemoryProperties(GetPhysicalDevice(), &allocatorMemoryProperties);
+
+        allocatorAtomSize = GetPhysicalDeviceProperties().limits.nonCoherentAtomSize;
+        memoryAllocatorStats.maxDeviceAllocationCount = (size_t)GetPhysicalDeviceProperties().limits.maxMemoryAllocationCount;
+
+        // Use smaller blocks for small heaps, like the host visible part of device local memory, so a single block doesn't take up most of the heap
+        for(uint32_t i = 0; i < allocatorMemoryProperties.memoryTypeCount; ++i) {
+            VkDeviceSize heapSize = allocatorMemoryProperties.memoryHeaps[allocatorMemoryProperties.memoryTypes[i].heapIndex].size;
+
+            memoryBlockSizes[i] = DEFAULT_MEMORY_BLOCK_SIZE;
+            if(heapSize <= SMALL_HEAP_SIZE) {
+                memoryBlockSizes[i] = RoundUpToPowerOfTwo(heapSize / 8 + 1) >> 1;
+                if(memoryBlockSizes[i] < MIN_MEMORY_BLOCK_SIZE)
+                    memoryBlockSizes[i] = MIN_MEMORY_BLOCK_SIZE;
+            }
+        }
+
+        console::OutMessageFunction("Created memory allocator successfully.");
+    }
+    void DeleteMemoryAllocator() {
+        for(auto* block : memoryBlocks) {
+            if(block->allocationCount)
+                console::OutWarningFunction((string)"Freeing memory block with " + ToString(block->allocationCount) + " allocations left!");
+            DestroyMemoryBlock(block);
+        }
+        memoryBlocks.clear();
+
+        console::OutMessageFunction("Deleted memory allocator successfully.");
+    }
+
+    void AllocateMemory(const VkMemoryRequirements& memoryRequirements, VkMemoryPropertyFlags properties, bool8_t linear, MemoryAllocation& allocation) {
+        uint32_t memoryTypeIndex = FindMemoryType(memoryRequirements.memoryTypeBits, properties);
+
+        std::lock_guard<std::mutex> lock(memoryAllocatorMutex);
+
+        // Give the resource its own memory if it would take up more than half of a block; optimal images get their own
+        // memory from a quarter of a block, since they are usually large and long lived, like the depth images
+        VkDeviceSize dedicatedThreshold = memoryBlockSizes[memoryTypeIndex] >> (linear ? 1 : 2);
+
+        if(memoryRequirements.size > dedicatedThreshold || memoryRequirements.alignment > memoryBlockSizes[memoryTypeIndex]) {
+            allocation.offset = 0;
+            allocation.size = memoryRequirements.size;
+            allocation.mappedMemory = AllocateDeviceMemory(memoryRequirements.size, memoryTypeIndex, allocation.memory);
+            allocation.memoryTypeIndex = memoryTypeIndex;
+            allocation.block = nullptr;
+            allocation.order = 0;
+
+            ++memoryAllocatorStats.dedicatedAllocationCount;
+            memoryAllocatorStats.dedicatedSize += allocation.size;
+            return;
+        }
+
+        // Every range is aligned to its own size, so rounding the size up to the alignment satisfies it as well
+        VkDeviceSize nodeSize = memoryRequirements.size > memoryRequirements.alignment ? memoryRequirements.size : memoryRequirements.alignment;
+        uint32_t order = GetNodeOrder(nodeSize);
+
+        // Try every block of the same memory type, keeping linear and optimal resources in separate blocks to respect the buffer image granularity
+        VkDeviceSize offset;
+        MemoryBlock* block = nullptr;
+        for(auto* memoryBlock : memoryBlocks)
+            if(memoryBlock->memoryTypeIndex == memoryTypeIndex && memoryBlock->linear == linear && AllocateFromBlock(memoryBlock, order, offset)) {
+                block = memoryBlock;
+                break;
+            }
+
+        // Create a new block if no block had enough space
+        if(!block) {
+            block = CreateMemoryBlock(memoryTypeIndex, linear);
+            AllocateFromBlock(block, order, offset);
+        }
+
+        allocation.memory = block->memory;
+        allocation.offset = offset;
+        allocation.size = MIN_MEMORY_NODE_SIZE << order;
+        allocation.mappedMemory = block->mappedMemory ? block->mappedMemory + offset : nullptr;
+        allocation.memoryTypeIndex = memoryTypeIndex;
+        allocation.block = block;
+        allocation.order = order;
+
+        ++memoryAllocatorStats.blockAllocationCount;
+        memoryAllocatorStats.usedBlockSize += allocation.size;
+    }
+    void FreeMemory(MemoryAllocation& allocation) {
+        // Exit the function if the allocation was never made, like vkFreeMemory does for null handles
+        if(!allocation.memory)
+            return;
+
+        std::lock_guard<std::mutex> lock(memoryAllocatorMutex);
+
+        // Free dedicated allocations' memory directly
+        if(!allocation.block) {
+            FreeDeviceMemory(allocation.memory);
+
+            --memoryAllocatorStats.dedicatedAllocationCount;
+            memoryAllocatorStats.dedicatedSize -= allocation.size;
+        } else {
+            MemoryBlock* block = allocation.block;
+            FreeFromBlock(block, allocation.offset, allocation.order);
+
+            --memoryAllocatorStats.blockAllocationCount;
+            memoryAllocatorStats.usedBlockSize -= allocation.size;
+
+            // Destroy the block if it's empty, unless it's the last block of its kind, so alternating allocations and frees don't keep recreating it
+            if(!block->allocationCount) {
+                size_t blockIndex = memoryBlocks.size();
+                bool8_t otherBlockFound = false;
+
+                for(size_t i = 0; i < memoryBlocks.size(); ++i) {
+                    if(memoryBlocks[i] == block)
+                        blockIndex = i;
+                    else if(memoryBlocks[i]->memoryTypeIndex == block->memoryTypeIndex && memoryBlocks[i]->linear == block->linear)
+                        otherBlockFound = true;
+                }
+
+                if(otherBlockFound) {
+                    memoryBlocks[blockIndex] = memoryBlocks.back();
+                    memoryBlocks.pop_back();
+                    DestroyMemoryBlock(block);
+                }
+            }
+        }
+
+        allocation.memory = VK_NULL_HANDLE;
+        allocation.mappedMemory = nullptr;
+        allocation.block = nullptr;
+    }
+    void FlushMemory(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) {
+        // Exit the function if the memory doesn't need flushing
+        if((allocatorMemoryProperties.memoryTypes[allocation.memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+            return;
+
+        // Align the range to the non coherent atom size, which always stays inside the allocation's range for block allocations
+        VkDeviceSize rangeStart = allocation.offset + offset;
+        VkDeviceSize rangeEnd = size == VK_WHOLE_SIZE ? allocation.offset + allocation.size : rangeStart + size;
+
+        rangeStart -= rangeStart % allocatorAtomSize;
+        rangeEnd = (rangeEnd + allocatorAtomSize - 1) / allocatorAtomSize * allocatorAtomSize;
+
+        // Set the mapped memory range
+        VkMappedMemoryRange memoryRange;
+
+        memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        memoryRange.pNext = nullptr;
+        memoryRange.memory = allocation.memory;
+        memoryRange.offset = rangeStart;
+        memoryRange.size = rangeEnd > allocation.offset + allocation.size ? VK_WHOLE_SIZE : rangeEnd - rangeStart;
+
+        vkFlushMappedMemoryRanges(GetDevice(), 1, &memoryRange);
+    }
+
+    MemoryAllocatorStats GetMemoryAllocatorStats() {
+        std::lock_guard<std::mutex> lock(memoryAllocatorMutex);
+
+        MemoryAllocatorStats stats = memoryAllocatorStats;
+        stats.largestFreeRange = 0;
+
+        // Find the largest free range of every block; any free memory outside of it counts as fragmented
+        VkDeviceSize fragmentedSize = 0;
+        for(auto* block : memoryBlocks) {
+            VkDeviceSize largestFreeRange = 0;
+            for(uint32_t order = block->orderCount; order && !largestFreeRange; --order)
+                if(!block->freeNodes[order - 1].empty())
+                    largestFreeRange = MIN_MEMORY_NODE_SIZE << (order - 1);
+
+            fragmentedSize += block->size - block->usedSize - largestFreeRange;
+            if(largestFreeRange > stats.largestFreeRange)
+                stats.largestFreeRange = largestFreeRange;
+        }
+
+        VkDeviceSize freeSize = stats.blockSize - stats.usedBlockSize;
+        stats.fragmentation = freeSize ? (float32_t)fragmentedSize / (float32_t)freeSize : 0.f;
+
+        return stats;
+    }
+}
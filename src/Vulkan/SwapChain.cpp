@@ -2,21 +2,46 @@
 #include "Vulkan/Device.hpp"
 #include "General/Application.hpp"
 
+#include <chrono>
+#include <mutex>
 #include <limits.h>
 
 namespace wfe::editor {
+    // Structs
+    struct RetiredSwapChain {
+        VkSwapchainKHR swapChain;
+        vector<VkImageView> imageViews;
+        vector<VkImage> depthImages;
+        vector<MemoryAllocation> depthImageAllocations;
+        vector<VkImageView> depthImageViews;
+        vector<VkFramebuffer> framebuffers;
+        uint64_t retireFrame;
+    };
+
+    // Constants
+    const float64_t SWAP_CHAIN_RECREATE_SETTLE_TIME = 0.016; // The time without new requests after which a pending recreation is applied, in seconds
+    const float64_t MAX_SWAP_CHAIN_RECREATE_DELAY = 0.1;     // The longest a recreation stays pending during a continuous burst of requests, in seconds
+
     // Variables
     VkSwapchainKHR swapChain;
     VkFormat swapChainImageFormat;
     VkExtent2D swapChainExtent;
 
     vector<VkImage> swapChainImages;
+    vector<MemoryAllocation> offscreenImageAllocations;
     vector<VkImageView> swapChainImageViews;
     vector<VkImage> depthImages;
-    vector<VkDeviceMemory> depthImageMemories;
+    vector<MemoryAllocation> depthImageAllocations;
     vector<VkImageView> depthImageViews;
 
-    VkRenderPass renderPass;
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    SwapChainAttachmentInfo attachmentInfo{ false };
+
+    bool8_t dynamicRenderingAllowed = true;
+    bool8_t dynamicRenderingEnabled = false;
+    VkPipelineRenderingCreateInfoKHR pipelineRenderingInfo;
+    PFN_vkCmdBeginRenderingKHR cmdBeginRendering = nullptr;
+    PFN_vkCmdEndRenderingKHR cmdEndRendering = nullptr;
 
     vector<VkFramebuffer> swapChainFramebuffers;
 
@@ -25,7 +50,48 @@ namespace wfe::editor {
     VkFence inFlightFences[MAX_FRAMES_IN_FLIGHT];
     vector<VkFence> imagesInFlight;
 
+    bool8_t timelineSemaphoreAllowed = true;
+    bool8_t timelineSemaphoreEnabled = false;
+    VkSemaphore frameTimelineSemaphore = VK_NULL_HANDLE;   // Reaches the value of every frame once the frame finishes, replacing the in flight fences
+    vector<uint64_t> imageFrameValues;                     // The value of the last frame that rendered to every image, replacing the images in flight
+    uint64_t completedFrameValue = 0;
+
+    vector<VkCommandBuffer> queuedFrameCommandBuffers; // Command buffers recorded on other threads, submitted with the next frame
+    std::mutex queuedFrameCommandBuffersMutex;
+    PFN_vkWaitSemaphoresKHR waitSemaphoresFunction = nullptr;
+    PFN_vkGetSemaphoreCounterValueKHR getSemaphoreCounterValueFunction = nullptr;
+
     uint32_t currentFrame;
+    uint64_t swapChainSubmitCount = 0;
+
+    vector<RetiredSwapChain> retiredSwapChains;
+    bool8_t recreationPending = false;
+    std::chrono::steady_clock::time_point firstRecreateRequest;
+    std::chrono::steady_clock::time_point lastRecreateRequest;
+    SwapChainStats swapChainStats{};
+
+    VkPresentModeKHR preferredPresentMode = VK_PRESENT_MODE_MAILBOX_KHR;
+    VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR;
+    uint32_t preferredImageCount = 0;
+    uint32_t lastSubmittedImage = UINT32_MAX;
+
+    VkBuffer readbackBuffer = VK_NULL_HANDLE;
+    MemoryAllocation readbackBufferAllocation;
+    VkDeviceSize readbackBufferSize = 0;
+
+    // Structs
+    struct PresentModeName {
+        VkPresentModeKHR presentMode;
+        const char_t* name;
+    };
+
+    // Constants
+    const PresentModeName PRESENT_MODE_NAMES[] = {
+        { VK_PRESENT_MODE_FIFO_KHR, "fifo" },
+        { VK_PRESENT_MODE_FIFO_RELAXED_KHR, "fiforelaxed" },
+        { VK_PRESENT_MODE_MAILBOX_KHR, "mailbox" },
+        { VK_PRESENT_MODE_IMMEDIATE_KHR, "immediate" }
+    };
 
     // Internal helper functions
     static VkSurfaceFormatKHR ChooseSwapSurfaceFormat(const vector<VkSurfaceFormatKHR>& availableFormats) {
@@ -38,12 +104,14 @@ namespace wfe::editor {
         return availableFormats[0];
     }
     static VkPresentModeKHR ChooseSwapPresentMode(const vector<VkPresentModeKHR>& availablePresentModes) {
-        // Select mailbox if available
+        // Select the preferred present mode if available
         for(const auto& availablePresentMode : availablePresentModes)
-            if(availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR)
+            if(availablePresentMode == preferredPresentMode)
                 return availablePresentMode;
         
-        // Select VSync
+        // Select VSync, which every surface supports
+        if(preferredPresentMode != VK_PRESENT_MODE_FIFO_KHR)
+            console::OutWarningFunction((string)"The surface doesn't support the " + PresentModeToString(preferredPresentMode) + " present mode! Using fifo instead.");
         return VK_PRESENT_MODE_FIFO_KHR;
     }
     static VkExtent2D ChooseSwapChainExtent(const VkSurfaceCapabilitiesKHR& capabilities) {
@@ -71,11 +139,13 @@ namespace wfe::editor {
 
         // Get the surface format, present mode and extent
         VkSurfaceFormatKHR surfaceFormat = ChooseSwapSurfaceFormat(swapChainSupport.formats);
-        VkPresentModeKHR presentMode = ChooseSwapPresentMode(swapChainSupport.presentModes);
+        presentMode = ChooseSwapPresentMode(swapChainSupport.presentModes);
         VkExtent2D extent = ChooseSwapChainExtent(swapChainSupport.capabilities);
 
-        // Set the image count
-        uint32_t imageCount = swapChainSupport.capabilities.minImageCount + 1;
+        // Set the image count, clamped to the surface's limits
+        uint32_t imageCount = preferredImageCount ? preferredImageCount : swapChainSupport.capabilities.minImageCount + 1;
+        if(imageCount < swapChainSupport.capabilities.minImageCount)
+            imageCount = swapChainSupport.capabilities.minImageCount;
         if(swapChainSupport.capabilities.maxImageCount > 0 && imageCount > swapChainSupport.capabilities.maxImageCount)
             imageCount = swapChainSupport.capabilities.maxImageCount;
         
@@ -124,6 +194,46 @@ namespace wfe::editor {
         swapChainImages.resize(swapChainImageCount);
         vkGetSwapchainImagesKHR(GetDevice(), swapChain, &swapChainImageCount, swapChainImages.data());
     }
+    static void CreateOffscreenImages() {
+        // Render at the main window's size, since there is no surface to take the size from
+        swapChainImageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+        swapChainExtent = { (uint32_t)GetMainWindowWidth(), (uint32_t)GetMainWindowHeight() };
+
+        // Set the image create info
+        VkImageCreateInfo imageInfo;
+
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.pNext = nullptr;
+        imageInfo.flags = 0;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = swapChainImageFormat;
+        imageInfo.extent = { swapChainExtent.width, swapChainExtent.height, 1 };
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.queueFamilyIndexCount = 0;
+        imageInfo.pQueueFamilyIndices = nullptr;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        // Create one image for every frame in flight
+        swapChainImages.resize(MAX_FRAMES_IN_FLIGHT);
+        offscreenImageAllocations.resize(MAX_FRAMES_IN_FLIGHT);
+
+        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+            CreateImage(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, swapChainImages[i], offscreenImageAllocations[i]);
+    }
+    static void DestroyOffscreenImages() {
+        for(auto image : swapChainImages)
+            vkDestroyImage(GetDevice(), image, GetVulkanAllocator());
+        for(auto& imageAllocation : offscreenImageAllocations)
+            FreeMemory(imageAllocation);
+        
+        swapChainImages.clear();
+        offscreenImageAllocations.clear();
+    }
     static void CreateImageViews() {
         swapChainImageViews.resize(swapChainImages.size());
 
@@ -153,10 +263,18 @@ namespace wfe::editor {
         }
     }
     static void CreateDepthResources() {
+        // Exit the function if the render pass has no depth attachment
+        if(!attachmentInfo.depthAttachment) {
+            depthImages.clear();
+            depthImageAllocations.clear();
+            depthImageViews.clear();
+            return;
+        }
+
         VkFormat depthFormat = FindDepthFormat();
 
         depthImages.resize(swapChainImages.size());
-        depthImageMemories.resize(swapChainImages.size());
+        depthImageAllocations.resize(swapChainImages.size());
         depthImageViews.resize(swapChainImages.size());
 
         // Set the image create info
@@ -215,7 +333,7 @@ namespace wfe::editor {
         // Create every image
         for(size_t i = 0; i < swapChainImages.size(); ++i) {
             // Create the image
-            CreateImage(imageInfo, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, depthImages[i], depthImageMemories[i]);
+            CreateImage(imageInfo, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, depthImages[i], depthImageAllocations[i]);
 
             // Create the image view
             imageViewInfo.image = depthImages[i];
@@ -232,7 +350,7 @@ namespace wfe::editor {
         EndSingleTimeCommands(commandBuffer);
     }
     static void CreateRenderPass() {
-        // Set the color and depth attachment descriptions
+        // Set the color and depth attachment descriptions; the depth attachment is only used if it was requested
         VkAttachmentDescription attachments[2];
 
         attachments[0].flags = 0;
@@ -243,10 +361,10 @@ namespace wfe::editor {
         attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
         attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        attachments[0].finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        attachments[0].finalLayout = IsHeadless() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
         attachments[1].flags = 0;
-        attachments[1].format = FindDepthFormat();
+        attachments[1].format = attachmentInfo.depthAttachment ? FindDepthFormat() : VK_FORMAT_UNDEFINED;
         attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
         attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
         attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
@@ -276,7 +394,7 @@ namespace wfe::editor {
         subpass.colorAttachmentCount = 1;
         subpass.pColorAttachments = &colorAttachmentRef;
         subpass.pResolveAttachments = nullptr;
-        subpass.pDepthStencilAttachment = &depthAttachmentRef;
+        subpass.pDepthStencilAttachment = attachmentInfo.depthAttachment ? &depthAttachmentRef : nullptr;
         subpass.preserveAttachmentCount = 0;
         subpass.pPreserveAttachments = nullptr;
 
@@ -286,7 +404,7 @@ namespace wfe::editor {
         createInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
         createInfo.pNext = nullptr;
         createInfo.flags = 0;
-        createInfo.attachmentCount = 2;
+        createInfo.attachmentCount = GetSwapChainAttachmentCount();
         createInfo.pAttachments = attachments;
         createInfo.subpassCount = 1;
         createInfo.pSubpasses = &subpass;
@@ -297,7 +415,54 @@ namespace wfe::editor {
         if(result != VK_SUCCESS)
             console::OutFatalError((string)"Failed to create render pass! Error code: " + VkResultToString(result), 1);
     }
+    static void LoadDynamicRendering() {
+        // Use dynamic rendering only if the device supports it and it wasn't disabled
+        dynamicRenderingEnabled = dynamicRenderingAllowed && IsDynamicRenderingSupported();
+        if(!dynamicRenderingEnabled)
+            return;
+        
+        // Load the dynamic rendering commands
+        cmdBeginRendering = (PFN_vkCmdBeginRenderingKHR)vkGetDeviceProcAddr(GetDevice(), "vkCmdBeginRenderingKHR");
+        cmdEndRendering = (PFN_vkCmdEndRenderingKHR)vkGetDeviceProcAddr(GetDevice(), "vkCmdEndRenderingKHR");
+
+        if(!cmdBeginRendering || !cmdEndRendering) {
+            console::OutWarningFunction("Failed to load the dynamic rendering commands! Falling back to a render pass.");
+            dynamicRenderingEnabled = false;
+        }
+    }
+    static void LoadTimelineSemaphore() {
+        // Use the timeline semaphore only if the device supports it and it wasn't disabled
+        timelineSemaphoreEnabled = timelineSemaphoreAllowed && IsTimelineSemaphoreSupported();
+        if(!timelineSemaphoreEnabled)
+            return;
+        
+        // Load the timeline semaphore commands
+        waitSemaphoresFunction = (PFN_vkWaitSemaphoresKHR)vkGetDeviceProcAddr(GetDevice(), "vkWaitSemaphoresKHR");
+        getSemaphoreCounterValueFunction = (PFN_vkGetSemaphoreCounterValueKHR)vkGetDeviceProcAddr(GetDevice(), "vkGetSemaphoreCounterValueKHR");
+
+        if(!waitSemaphoresFunction || !getSemaphoreCounterValueFunction) {
+            console::OutWarningFunction("Failed to load the timeline semaphore commands! Falling back to fences.");
+            timelineSemaphoreEnabled = false;
+        }
+    }
+    static void SetPipelineRenderingInfo() {
+        // Set the pipeline rendering create info; the color format is read from the swap chain when the pipeline is created
+        pipelineRenderingInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        pipelineRenderingInfo.pNext = nullptr;
+        pipelineRenderingInfo.viewMask = 0;
+        pipelineRenderingInfo.colorAttachmentCount = 1;
+        pipelineRenderingInfo.pColorAttachmentFormats = &swapChainImageFormat;
+        pipelineRenderingInfo.depthAttachmentFormat = attachmentInfo.depthAttachment ? FindDepthFormat() : VK_FORMAT_UNDEFINED;
+        pipelineRenderingInfo.stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+
+        if(attachmentInfo.depthAttachment && HasStencilComponent(pipelineRenderingInfo.depthAttachmentFormat))
+            pipelineRenderingInfo.stencilAttachmentFormat = pipelineRenderingInfo.depthAttachmentFormat;
+    }
     static void CreateFramebuffers() {
+        // Dynamic rendering renders straight to the image views, so no framebuffers are needed
+        if(dynamicRenderingEnabled)
+            return;
+
         swapChainFramebuffers.resize(swapChainImageViews.size());
 
         // Set the framebuffer create info without the attachment; it will be set for every framebuffer
@@ -307,14 +472,14 @@ namespace wfe::editor {
         framebufferInfo.pNext = nullptr;
         framebufferInfo.flags = 0;
         framebufferInfo.renderPass = renderPass;
-        framebufferInfo.attachmentCount = 2;
+        framebufferInfo.attachmentCount = GetSwapChainAttachmentCount();
         framebufferInfo.width = swapChainExtent.width;
         framebufferInfo.height = swapChainExtent.height;
         framebufferInfo.layers = 1;
 
         // Create every framebuffer
         for(size_t i = 0; i < swapChainFramebuffers.size(); ++i) {
-            VkImageView attachments[] = { swapChainImageViews[i], depthImageViews[i] };
+            VkImageView attachments[] = { swapChainImageViews[i], attachmentInfo.depthAttachment ? depthImageViews[i] : VK_NULL_HANDLE };
 
             framebufferInfo.pAttachments = attachments;
 
@@ -323,6 +488,38 @@ namespace wfe::editor {
                 console::OutFatalError((string)"Failed to create framebuffer! Error code: " + VkResultToString(result), 1);
         }
     }
+    static void DestroyRetiredSwapChains(bool8_t destroyAll) {
+        for(size_t i = 0; i < retiredSwapChains.size();) {
+            // Skip the swap chain if a frame that might use it is still in flight. Every frame at least
+            // MAX_FRAMES_IN_FLIGHT submissions old is finished, since its fence was waited on to acquire this frame
+            if(!destroyAll && !HasGPUReachedFrame(retiredSwapChains[i].retireFrame)) {
+                ++i;
+                continue;
+            }
+
+            // Destroy every object of the retired swap chain
+            RetiredSwapChain& retiredSwapChain = retiredSwapChains[i];
+
+            for(auto framebuffer : retiredSwapChain.framebuffers)
+                vkDestroyFramebuffer(GetDevice(), framebuffer, GetVulkanAllocator());
+            
+            for(auto depthImageView : retiredSwapChain.depthImageViews)
+                vkDestroyImageView(GetDevice(), depthImageView, GetVulkanAllocator());
+            for(auto depthImage : retiredSwapChain.depthImages)
+                vkDestroyImage(GetDevice(), depthImage, GetVulkanAllocator());
+            for(auto& depthImageAllocation : retiredSwapChain.depthImageAllocations)
+                FreeMemory(depthImageAllocation);
+            
+            for(auto imageView : retiredSwapChain.imageViews)
+                vkDestroyImageView(GetDevice(), imageView, GetVulkanAllocator());
+            
+            vkDestroySwapchainKHR(GetDevice(), retiredSwapChain.swapChain, GetVulkanAllocator());
+
+            // Remove the swap chain from the list
+            retiredSwapChains[i] = retiredSwapChains.back();
+            retiredSwapChains.pop_back();
+        }
+    }
     static void CreateSyncObjects() {
         imagesInFlight.resize(swapChainImages.size());
 
@@ -354,82 +551,447 @@ namespace wfe::editor {
                 console::OutFatalError((string)"Failed to create render finished semaphore! Error code: " + VkResultToString(result), 1);
         }
 
+        for(auto& imageInFlight : imagesInFlight)
+            imageInFlight = VK_NULL_HANDLE;
+
+        // Track the frames with the timeline semaphore if it's available
+        LoadTimelineSemaphore();
+        if(timelineSemaphoreEnabled) {
+            // Set the semaphore type create info
+            VkSemaphoreTypeCreateInfoKHR semaphoreTypeInfo;
+
+            semaphoreTypeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+            semaphoreTypeInfo.pNext = nullptr;
+            semaphoreTypeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+            semaphoreTypeInfo.initialValue = swapChainSubmitCount;
+
+            semaphoreInfo.pNext = &semaphoreTypeInfo;
+
+            // Create the frame timeline semaphore
+            auto result = vkCreateSemaphore(GetDevice(), &semaphoreInfo, GetVulkanAllocator(), &frameTimelineSemaphore);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to create frame timeline semaphore! Error code: " + VkResultToString(result), 1);
+            
+            imageFrameValues.resize(swapChainImages.size());
+            for(auto& imageFrameValue : imageFrameValues)
+                imageFrameValue = 0;
+            
+            return;
+        }
+
         // Create every in flight fence
         for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
             auto result = vkCreateFence(GetDevice(), &fenceInfo, GetVulkanAllocator(), inFlightFences + i);
             if(result != VK_SUCCESS)
                 console::OutFatalError((string)"Failed to create in flight fence! Error code: " + VkResultToString(result), 1);
         }
-
-        for(auto& imageInFlight : imagesInFlight)
-            imageInFlight = VK_NULL_HANDLE;
     }
 
     // External functions
     void CreateSwapChain() {
-        CreateSwapChainInternal();
+        // Render into offscreen images in headless mode, since there is no surface
+        if(IsHeadless())
+            CreateOffscreenImages();
+        else
+            CreateSwapChainInternal();
         CreateImageViews();
         CreateDepthResources();
-        CreateRenderPass();
+        LoadDynamicRendering();
+        if(dynamicRenderingEnabled)
+            SetPipelineRenderingInfo();
+        else
+            CreateRenderPass();
         CreateFramebuffers();
         CreateSyncObjects();
-        console::OutMessageFunction("Created swap chain successfully.");
+        
+        if(dynamicRenderingEnabled)
+            console::OutMessageFunction("Created swap chain successfully, using dynamic rendering.");
+        else
+            console::OutMessageFunction("Created swap chain successfully.");
+        if(timelineSemaphoreEnabled)
+            console::OutMessageFunction("Synchronizing frames with a timeline semaphore.");
     }
     void DeleteSwapChain() {
+        DestroyRetiredSwapChains(true);
+
         for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
             vkDestroySemaphore(GetDevice(), imageAvailableSemaphores[i], GetVulkanAllocator());
         for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
             vkDestroySemaphore(GetDevice(), renderFinishedSemaphores[i], GetVulkanAllocator());
-        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
             vkDestroyFence(GetDevice(), inFlightFences[i], GetVulkanAllocator());
+            inFlightFences[i] = VK_NULL_HANDLE;
+        }
+        
+        if(frameTimelineSemaphore) {
+            vkDestroySemaphore(GetDevice(), frameTimelineSemaphore, GetVulkanAllocator());
+            frameTimelineSemaphore = VK_NULL_HANDLE;
+        }
 
         for(auto framebuffer : swapChainFramebuffers)
             vkDestroyFramebuffer(GetDevice(), framebuffer, GetVulkanAllocator());
         
-        vkDestroyRenderPass(GetDevice(), renderPass, GetVulkanAllocator());
+        swapChainFramebuffers.clear();
+        
+        if(renderPass) {
+            vkDestroyRenderPass(GetDevice(), renderPass, GetVulkanAllocator());
+            renderPass = VK_NULL_HANDLE;
+        }
 
         for(auto depthImageView : depthImageViews)
             vkDestroyImageView(GetDevice(), depthImageView, GetVulkanAllocator());
         for(auto depthImage : depthImages)
             vkDestroyImage(GetDevice(), depthImage, GetVulkanAllocator());
-        for(auto depthImageMemory : depthImageMemories)
-            vkFreeMemory(GetDevice(), depthImageMemory, GetVulkanAllocator());
+        for(auto& depthImageAllocation : depthImageAllocations)
+            FreeMemory(depthImageAllocation);
         
         for(auto imageView : swapChainImageViews)
             vkDestroyImageView(GetDevice(), imageView, GetVulkanAllocator());
         
-        vkDestroySwapchainKHR(GetDevice(), swapChain, GetVulkanAllocator());
+        if(readbackBuffer) {
+            vkDestroyBuffer(GetDevice(), readbackBuffer, GetVulkanAllocator());
+            FreeMemory(readbackBufferAllocation);
+            readbackBuffer = VK_NULL_HANDLE;
+            readbackBufferSize = 0;
+        }
+
+        if(IsHeadless())
+            DestroyOffscreenImages();
+        else {
+            vkDestroySwapchainKHR(GetDevice(), swapChain, GetVulkanAllocator());
+            swapChain = VK_NULL_HANDLE;
+        }
         console::OutMessageFunction("Deleted swap chain successfully.");
     }
     void RecreateSwapChain() {
-        // Destroy every swap chain related object
-        for(auto framebuffer : swapChainFramebuffers)
-            vkDestroyFramebuffer(GetDevice(), framebuffer, GetVulkanAllocator());
-        
-        for(auto depthImageView : depthImageViews)
-            vkDestroyImageView(GetDevice(), depthImageView, GetVulkanAllocator());
-        for(auto depthImage : depthImages)
-            vkDestroyImage(GetDevice(), depthImage, GetVulkanAllocator());
-        for(auto depthImageMemory : depthImageMemories)
-            vkFreeMemory(GetDevice(), depthImageMemory, GetVulkanAllocator());
-        
-        for(auto imageView : swapChainImageViews)
-            vkDestroyImageView(GetDevice(), imageView, GetVulkanAllocator());
-        
-        // Store the old swapchain and create the new one
-        VkSwapchainKHR oldSwapChain = swapChain;
-        CreateSwapChainInternal(oldSwapChain);
+        auto recreateStartTime = std::chrono::steady_clock::now();
 
-        // Delete the old swap chain
-        vkDestroySwapchainKHR(GetDevice(), oldSwapChain, GetVulkanAllocator());
+        if(IsHeadless()) {
+            // The offscreen images can't be handed over like swap chain images, so wait for every frame in flight to finish using them
+            WaitForDeviceIdle();
+
+            // Destroy every swap chain related object
+            for(auto framebuffer : swapChainFramebuffers)
+                vkDestroyFramebuffer(GetDevice(), framebuffer, GetVulkanAllocator());
+            
+            for(auto depthImageView : depthImageViews)
+                vkDestroyImageView(GetDevice(), depthImageView, GetVulkanAllocator());
+            for(auto depthImage : depthImages)
+                vkDestroyImage(GetDevice(), depthImage, GetVulkanAllocator());
+            for(auto& depthImageAllocation : depthImageAllocations)
+                FreeMemory(depthImageAllocation);
+            
+            for(auto imageView : swapChainImageViews)
+                vkDestroyImageView(GetDevice(), imageView, GetVulkanAllocator());
+
+            // Recreate the offscreen images at the new size
+            DestroyOffscreenImages();
+            CreateOffscreenImages();
+        } else {
+            // Frames in flight might still use the old objects, so retire them instead of waiting for the device to go idle
+            RetiredSwapChain retiredSwapChain;
+
+            retiredSwapChain.swapChain = swapChain;
+            retiredSwapChain.imageViews = swapChainImageViews;
+            retiredSwapChain.depthImages = depthImages;
+            retiredSwapChain.depthImageAllocations = depthImageAllocations;
+            retiredSwapChain.depthImageViews = depthImageViews;
+            retiredSwapChain.framebuffers = swapChainFramebuffers;
+            retiredSwapChain.retireFrame = swapChainSubmitCount;
+
+            retiredSwapChains.push_back(retiredSwapChain);
+
+            // Create the new swap chain, handing the old one over to it
+            CreateSwapChainInternal(swapChain);
+        }
+        lastSubmittedImage = UINT32_MAX;
 
         // Create every swap chain related object
         CreateImageViews();
         CreateDepthResources();
         CreateFramebuffers();
+
+        // Reset the images in flight, as the image count might have changed
+        imagesInFlight.resize(swapChainImages.size());
+        for(auto& imageInFlight : imagesInFlight)
+            imageInFlight = VK_NULL_HANDLE;
+        
+        imageFrameValues.resize(swapChainImages.size());
+        for(auto& imageFrameValue : imageFrameValues)
+            imageFrameValue = 0;
+        
+        recreationPending = false;
+
+        // Update the recreation stats
+        float64_t recreateTime = std::chrono::duration<float64_t, std::milli>(std::chrono::steady_clock::now() - recreateStartTime).count();
+
+        ++swapChainStats.recreateCount;
+        swapChainStats.lastRecreateTime = recreateTime;
+        swapChainStats.totalRecreateTime += recreateTime;
+    }
+    void RequestSwapChainRecreation() {
+        auto currentTime = std::chrono::steady_clock::now();
+
+        // Merge the request into the pending recreation, if there is one
+        if(recreationPending)
+            ++swapChainStats.coalescedRequestCount;
+        else {
+            recreationPending = true;
+            firstRecreateRequest = currentTime;
+        }
+        lastRecreateRequest = currentTime;
+    }
+    bool8_t IsSwapChainRecreationPending() {
+        return recreationPending;
+    }
+    bool8_t UpdateSwapChain() {
+        if(!recreationPending)
+            return false;
+        
+        // The swap chain will be created with the current settings anyway if it doesn't exist
+        if(IsHeadless() || !swapChain) {
+            recreationPending = false;
+            return false;
+        }
+
+        // Wait for the requests to settle, unless they kept coming for too long, so an interactive resize only recreates the swap chain a few times
+        auto currentTime = std::chrono::steady_clock::now();
+        if(std::chrono::duration<float64_t>(currentTime - lastRecreateRequest).count() < SWAP_CHAIN_RECREATE_SETTLE_TIME && std::chrono::duration<float64_t>(currentTime - firstRecreateRequest).count() < MAX_SWAP_CHAIN_RECREATE_DELAY)
+            return false;
+        
+        RecreateSwapChain();
+        return true;
+    }
+    const SwapChainStats& GetSwapChainStats() {
+        return swapChainStats;
+    }
+
+    const SwapChainAttachmentInfo& GetSwapChainAttachmentInfo() {
+        return attachmentInfo;
+    }
+    void SetSwapChainAttachmentInfo(const SwapChainAttachmentInfo& newAttachmentInfo) {
+        attachmentInfo = newAttachmentInfo;
+    }
+    uint32_t GetSwapChainAttachmentCount() {
+        return attachmentInfo.depthAttachment ? 2 : 1;
+    }
+
+    bool8_t IsDynamicRenderingEnabled() {
+        return dynamicRenderingEnabled;
+    }
+    void DisableDynamicRendering() {
+        dynamicRenderingAllowed = false;
+    }
+    const VkPipelineRenderingCreateInfoKHR* GetPipelineRenderingCreateInfo() {
+        return &pipelineRenderingInfo;
+    }
+
+    bool8_t IsTimelineSemaphoreEnabled() {
+        return timelineSemaphoreEnabled;
+    }
+    void DisableTimelineSemaphore() {
+        timelineSemaphoreAllowed = false;
+    }
+    VkSemaphore GetFrameTimelineSemaphore() {
+        return frameTimelineSemaphore;
+    }
+    uint64_t GetSubmittedFrameValue() {
+        return swapChainSubmitCount;
+    }
+    uint64_t GetCompletedFrameValue() {
+        if(timelineSemaphoreEnabled) {
+            // Read the timeline semaphore's current value
+            uint64_t value;
+            auto result = getSemaphoreCounterValueFunction(GetDevice(), frameTimelineSemaphore, &value);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to get semaphore counter value! Error code: " + VkResultToString(result), 1);
+            
+            if(value > completedFrameValue)
+                completedFrameValue = value;
+            
+            return completedFrameValue;
+        }
+
+        // Check the in flight fence of every frame that might still be running; frame k is submitted with fence (k - 1) % MAX_FRAMES_IN_FLIGHT
+        for(uint64_t value = completedFrameValue + 1; value <= swapChainSubmitCount; ++value) {
+            if(vkGetFenceStatus(GetDevice(), inFlightFences[(value - 1) % MAX_FRAMES_IN_FLIGHT]) != VK_SUCCESS)
+                break;
+            completedFrameValue = value;
+        }
+
+        return completedFrameValue;
+    }
+    bool8_t HasGPUReachedFrame(uint64_t value) {
+        return value <= completedFrameValue || value <= GetCompletedFrameValue();
+    }
+    void WaitForFrame(uint64_t value) {
+        // Exit the function if the frame already finished
+        if(value <= completedFrameValue)
+            return;
+        
+        if(value > swapChainSubmitCount) {
+            console::OutWarningFunction("Tried to wait for a frame that wasn't submitted yet!");
+            return;
+        }
+
+        if(timelineSemaphoreEnabled) {
+            // Set the semaphore wait info
+            VkSemaphoreWaitInfoKHR waitInfo;
+
+            waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+            waitInfo.pNext = nullptr;
+            waitInfo.flags = 0;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores = &frameTimelineSemaphore;
+            waitInfo.pValues = &value;
+
+            // Wait for the timeline semaphore to reach the frame's value
+            auto result = waitSemaphoresFunction(GetDevice(), &waitInfo, UINT64_MAX);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to wait for semaphore! Error code: " + VkResultToString(result), 1);
+            
+            completedFrameValue = value;
+            return;
+        }
+
+        // Wait for the frame's in flight fence
+        auto result = vkWaitForFences(GetDevice(), 1, inFlightFences + (value - 1) % MAX_FRAMES_IN_FLIGHT, VK_TRUE, UINT64_MAX);
+        if(result != VK_SUCCESS)
+            console::OutFatalError((string)"Failed to wait for fences! Error code: " + VkResultToString(result), 1);
+        
+        // The fence might have been reused by a later frame, which also finished
+        uint64_t fenceValue = value;
+        while(fenceValue + MAX_FRAMES_IN_FLIGHT <= swapChainSubmitCount)
+            fenceValue += MAX_FRAMES_IN_FLIGHT;
+        
+        if(fenceValue > completedFrameValue)
+            completedFrameValue = fenceValue;
+    }
+    void BeginSwapChainRendering(VkCommandBuffer commandBuffer, uint32_t imageIndex, const VkClearValue* clearValues) {
+        if(!dynamicRenderingEnabled) {
+            // Begin the render pass
+            VkRenderPassBeginInfo renderPassInfo;
+
+            renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            renderPassInfo.pNext = nullptr;
+            renderPassInfo.renderPass = renderPass;
+            renderPassInfo.framebuffer = swapChainFramebuffers[imageIndex];
+            renderPassInfo.renderArea = { { 0, 0 }, swapChainExtent };
+            renderPassInfo.clearValueCount = GetSwapChainAttachmentCount();
+            renderPassInfo.pClearValues = clearValues;
+
+            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+            return;
+        }
+
+        // Transition the color image to the attachment layout, discarding its old contents as the render pass would
+        VkImageMemoryBarrier barriers[2];
+
+        barriers[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barriers[0].pNext = nullptr;
+        barriers[0].srcAccessMask = 0;
+        barriers[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        barriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barriers[0].newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        barriers[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[0].image = swapChainImages[imageIndex];
+        barriers[0].subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        // Wait for the last frame's depth writes before clearing the depth image
+        if(attachmentInfo.depthAttachment) {
+            barriers[1].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barriers[1].pNext = nullptr;
+            barriers[1].srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            barriers[1].dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            barriers[1].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            barriers[1].newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+            barriers[1].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barriers[1].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barriers[1].image = depthImages[imageIndex];
+            barriers[1].subresourceRange = { VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1 };
+
+            if(pipelineRenderingInfo.stencilAttachmentFormat != VK_FORMAT_UNDEFINED)
+                barriers[1].subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+        }
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT, 0, 0, nullptr, 0, nullptr, GetSwapChainAttachmentCount(), barriers);
+
+        // Set the color attachment info
+        VkRenderingAttachmentInfoKHR colorAttachment;
+
+        colorAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        colorAttachment.pNext = nullptr;
+        colorAttachment.imageView = swapChainImageViews[imageIndex];
+        colorAttachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        colorAttachment.resolveMode = VK_RESOLVE_MODE_NONE_KHR;
+        colorAttachment.resolveImageView = VK_NULL_HANDLE;
+        colorAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        colorAttachment.clearValue = clearValues[0];
+
+        // Set the depth attachment info
+        VkRenderingAttachmentInfoKHR depthAttachment;
+
+        if(attachmentInfo.depthAttachment) {
+            depthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+            depthAttachment.pNext = nullptr;
+            depthAttachment.imageView = depthImageViews[imageIndex];
+            depthAttachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+            depthAttachment.resolveMode = VK_RESOLVE_MODE_NONE_KHR;
+            depthAttachment.resolveImageView = VK_NULL_HANDLE;
+            depthAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+            depthAttachment.clearValue = clearValues[1];
+        }
+
+        // Set the rendering info
+        VkRenderingInfoKHR renderingInfo;
+
+        renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.pNext = nullptr;
+        renderingInfo.flags = 0;
+        renderingInfo.renderArea = { { 0, 0 }, swapChainExtent };
+        renderingInfo.layerCount = 1;
+        renderingInfo.viewMask = 0;
+        renderingInfo.colorAttachmentCount = 1;
+        renderingInfo.pColorAttachments = &colorAttachment;
+        renderingInfo.pDepthAttachment = attachmentInfo.depthAttachment ? &depthAttachment : nullptr;
+        renderingInfo.pStencilAttachment = pipelineRenderingInfo.stencilAttachmentFormat != VK_FORMAT_UNDEFINED ? &depthAttachment : nullptr;
+
+        cmdBeginRendering(commandBuffer, &renderingInfo);
+    }
+    void EndSwapChainRendering(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+        if(!dynamicRenderingEnabled) {
+            // End the render pass; its final layout already prepares the image
+            vkCmdEndRenderPass(commandBuffer);
+            return;
+        }
+
+        cmdEndRendering(commandBuffer);
+
+        // Transition the color image to the present layout, or to the transfer layout in headless mode so it can be read back
+        VkImageMemoryBarrier barrier;
+
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext = nullptr;
+        barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        barrier.dstAccessMask = IsHeadless() ? VK_ACCESS_TRANSFER_READ_BIT : 0;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        barrier.newLayout = IsHeadless() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = swapChainImages[imageIndex];
+        barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, IsHeadless() ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
     }
 
     VkFramebuffer GetFrameBuffer(size_t index) {
+        if(dynamicRenderingEnabled)
+            return VK_NULL_HANDLE;
         return swapChainFramebuffers[index];
     }
     VkRenderPass GetRenderPass() {
@@ -457,6 +1019,52 @@ namespace wfe::editor {
         return currentFrame;
     }
 
+    VkPresentModeKHR GetPresentMode() {
+        return presentMode;
+    }
+    VkPresentModeKHR GetPreferredPresentMode() {
+        return preferredPresentMode;
+    }
+    void SetPreferredPresentMode(VkPresentModeKHR newPresentMode) {
+        if(newPresentMode == preferredPresentMode)
+            return;
+        
+        preferredPresentMode = newPresentMode;
+
+        // Recreate the swap chain with the new present mode, if it was already created
+        if(swapChain && !IsHeadless())
+            RequestSwapChainRecreation();
+    }
+    uint32_t GetPreferredImageCount() {
+        return preferredImageCount;
+    }
+    void SetPreferredImageCount(uint32_t imageCount) {
+        if(imageCount == preferredImageCount)
+            return;
+        
+        preferredImageCount = imageCount;
+
+        // Recreate the swap chain with the new image count, if it was already created
+        if(swapChain && !IsHeadless())
+            RequestSwapChainRecreation();
+    }
+    const char_t* PresentModeToString(VkPresentModeKHR presentMode) {
+        for(const auto& presentModeName : PRESENT_MODE_NAMES)
+            if(presentModeName.presentMode == presentMode)
+                return presentModeName.name;
+        
+        return "unknown";
+    }
+    bool8_t StringToPresentMode(const char_t* name, VkPresentModeKHR& presentMode) {
+        for(const auto& presentModeName : PRESENT_MODE_NAMES)
+            if(!strcmp(presentModeName.name, name)) {
+                presentMode = presentModeName.presentMode;
+                return true;
+            }
+        
+        return false;
+    }
+
     float32_t ExtentAspectRatio() {
         return (float32_t)swapChainExtent.width / swapChainExtent.height;
     }
@@ -465,22 +1073,68 @@ namespace wfe::editor {
     }
 
     VkResult AcquireNextImage(uint32_t* imageIndex) {
-        // Wait for the current in flight fence
-        auto result = vkWaitForFences(GetDevice(), 1, inFlightFences + currentFrame, VK_TRUE, UINT64_MAX);
-        if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to wait for fences! Error code: " + VkResultToString(result), 1);
+        // Wait for the last frame that used the current frame's objects
+        if(swapChainSubmitCount >= MAX_FRAMES_IN_FLIGHT)
+            WaitForFrame(swapChainSubmitCount + 1 - MAX_FRAMES_IN_FLIGHT);
+        
+        // Recycle the command buffers used by the frame that just finished and destroy the swap chains and resources no frame in flight uses anymore
+        ResetFrameCommandPools(currentFrame);
+        DestroyRetiredSwapChains(false);
+        DestroyDeferredResources();
+
+        // Every frame in flight has its own offscreen image in headless mode, and its frame was just waited on
+        if(IsHeadless()) {
+            *imageIndex = currentFrame;
+            return VK_SUCCESS;
+        }
+
+        auto result = vkAcquireNextImageKHR(GetDevice(), swapChain, UINT64_MAX, imageAvailableSemaphores[currentFrame], VK_NULL_HANDLE, imageIndex);
 
-        return vkAcquireNextImageKHR(GetDevice(), swapChain, UINT64_MAX, imageAvailableSemaphores[currentFrame], VK_NULL_HANDLE, imageIndex);
+        // Recreate the swap chain right away if it can't be presented to anymore, or once it settles if it no longer matches the surface
+        if(result == VK_ERROR_OUT_OF_DATE_KHR) {
+            ++swapChainStats.outOfDateRecreateCount;
+            RecreateSwapChain();
+        } else if(result == VK_SUBOPTIMAL_KHR)
+            RequestSwapChainRecreation();
+
+        return result;
+    }
+    void QueueFrameCommandBuffer(VkCommandBuffer commandBuffer) {
+        std::lock_guard<std::mutex> lock(queuedFrameCommandBuffersMutex);
+        queuedFrameCommandBuffers.push_back(commandBuffer);
     }
     VkResult SubmitCommandBuffers(const VkCommandBuffer* buffers, uint32_t* imageIndex, uint32_t bufferCount) {
-        // Wait for the current image in flight
-        if(imagesInFlight[*imageIndex] != VK_NULL_HANDLE) {
-            auto result = vkWaitForFences(GetDevice(), 1, imagesInFlight.data() + *imageIndex, VK_TRUE, UINT64_MAX);
-            if(result != VK_SUCCESS)
-                console::OutFatalError((string)"Failed to wait for fence! Error code: " + VkResultToString(result), 1);
+        uint64_t frameValue = swapChainSubmitCount + 1;
+
+        // Wait for the last frame that rendered to the current image
+        if(timelineSemaphoreEnabled) {
+            WaitForFrame(imageFrameValues[*imageIndex]);
+            imageFrameValues[*imageIndex] = frameValue;
+        } else {
+            if(imagesInFlight[*imageIndex] != VK_NULL_HANDLE) {
+                auto result = vkWaitForFences(GetDevice(), 1, imagesInFlight.data() + *imageIndex, VK_TRUE, UINT64_MAX);
+                if(result != VK_SUCCESS)
+                    console::OutFatalError((string)"Failed to wait for fence! Error code: " + VkResultToString(result), 1);
+            }
+
+            imagesInFlight[*imageIndex] = inFlightFences[currentFrame];
         }
 
-        imagesInFlight[*imageIndex] = inFlightFences[currentFrame];
+        // Submit the queued frame command buffers before the given ones
+        vector<VkCommandBuffer> frameCommandBuffers;
+        {
+            std::lock_guard<std::mutex> lock(queuedFrameCommandBuffersMutex);
+
+            if(queuedFrameCommandBuffers.size()) {
+                frameCommandBuffers = queuedFrameCommandBuffers;
+                for(uint32_t i = 0; i < bufferCount; ++i)
+                    frameCommandBuffers.push_back(buffers[i]);
+                
+                buffers = frameCommandBuffers.data();
+                bufferCount = (uint32_t)frameCommandBuffers.size();
+                queuedFrameCommandBuffers.clear();
+            }
+        }
 
         VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
 
@@ -497,15 +1151,67 @@ namespace wfe::editor {
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores = renderFinishedSemaphores + currentFrame;
 
-        // Reset the in flight fence
-        auto result = vkResetFences(GetDevice(), 1, inFlightFences + currentFrame);
-        if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to reset fence! Error code: " + VkResultToString(result), 1);
+        // Nothing is acquired or presented in headless mode, so there are no semaphores to wait on or signal
+        if(IsHeadless()) {
+            submitInfo.waitSemaphoreCount = 0;
+            submitInfo.pWaitSemaphores = nullptr;
+            submitInfo.pWaitDstStageMask = nullptr;
+            submitInfo.signalSemaphoreCount = 0;
+            submitInfo.pSignalSemaphores = nullptr;
+        }
+
+        VkResult result;
+        if(timelineSemaphoreEnabled) {
+            // Signal the timeline semaphore with the frame's value alongside the render finished semaphore, whose value is ignored
+            VkSemaphore signalSemaphores[] = { renderFinishedSemaphores[currentFrame], frameTimelineSemaphore };
+            uint64_t signalValues[] = { 0, frameValue };
+
+            if(IsHeadless()) {
+                submitInfo.signalSemaphoreCount = 1;
+                submitInfo.pSignalSemaphores = signalSemaphores + 1;
+            } else {
+                submitInfo.signalSemaphoreCount = 2;
+                submitInfo.pSignalSemaphores = signalSemaphores;
+            }
+
+            // Set the timeline semaphore submit info
+            VkTimelineSemaphoreSubmitInfoKHR timelineInfo;
+
+            timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineInfo.pNext = nullptr;
+            timelineInfo.waitSemaphoreValueCount = 0;
+            timelineInfo.pWaitSemaphoreValues = nullptr;
+            timelineInfo.signalSemaphoreValueCount = submitInfo.signalSemaphoreCount;
+            timelineInfo.pSignalSemaphoreValues = IsHeadless() ? signalValues + 1 : signalValues;
+
+            submitInfo.pNext = &timelineInfo;
+
+            // Submit to the queue
+            result = SubmitToQueue(GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to submit draw command buffer! Error code: " + VkResultToString(result), 1);
+        } else {
+            // Reset the in flight fence
+            result = vkResetFences(GetDevice(), 1, inFlightFences + currentFrame);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to reset fence! Error code: " + VkResultToString(result), 1);
+            
+            // Submit to the queue
+            result = SubmitToQueue(GetGraphicsQueue(), 1, &submitInfo, inFlightFences[currentFrame]);
+            if(result != VK_SUCCESS)
+                console::OutFatalError((string)"Failed to submit draw command buffer! Error code: " + VkResultToString(result), 1);
+        }
         
-        // Submit to the queue
-        result = vkQueueSubmit(GetGraphicsQueue(), 1, &submitInfo, inFlightFences[currentFrame]);
-        if(result != VK_SUCCESS)
-            console::OutFatalError((string)"Failed to submit draw command buffer! Error code: " + VkResultToString(result), 1);
+        lastSubmittedImage = *imageIndex;
+        ++swapChainSubmitCount;
+
+        // Skip presenting the image in headless mode
+        if(IsHeadless()) {
+            if(++currentFrame == MAX_FRAMES_IN_FLIGHT)
+                currentFrame = 0;
+
+            return VK_SUCCESS;
+        }
 
         // Set the present info
         VkPresentInfoKHR presentInfo;
@@ -520,12 +1226,83 @@ namespace wfe::editor {
         presentInfo.pResults = nullptr;
 
         // Present the image
-        result = vkQueuePresentKHR(GetPresentQueue(), &presentInfo);
+        result = PresentToQueue(presentInfo);
 
         // Increment the frame counter
         if(++currentFrame == MAX_FRAMES_IN_FLIGHT)
             currentFrame = 0;
+        
+        // Recreate the swap chain right away if it can't be presented to anymore, or once it settles if it no longer matches the surface
+        if(result == VK_ERROR_OUT_OF_DATE_KHR) {
+            ++swapChainStats.outOfDateRecreateCount;
+            RecreateSwapChain();
+        } else if(result == VK_SUBOPTIMAL_KHR)
+            RequestSwapChainRecreation();
 
         return result;
     }
+    bool8_t ReadLastFramePixels(void* pixels) {
+        // Exit the function if no frame was submitted since the images were created
+        if(lastSubmittedImage == UINT32_MAX)
+            return false;
+        
+        // The last frame's image is only left in a layout that can be copied from in headless mode
+        if(!IsHeadless()) {
+            console::OutWarningFunction("Frame readback is only supported in headless mode.");
+            return false;
+        }
+
+        // Create the readback buffer if it doesn't exist or if it's too small
+        VkDeviceSize size = (VkDeviceSize)swapChainExtent.width * swapChainExtent.height * 4;
+        if(readbackBufferSize < size) {
+            if(readbackBuffer) {
+                vkDestroyBuffer(GetDevice(), readbackBuffer, GetVulkanAllocator());
+                FreeMemory(readbackBufferAllocation);
+            }
+
+            CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, readbackBuffer, readbackBufferAllocation);
+            readbackBufferSize = size;
+        }
+
+        // Set the image memory barrier info, which makes the frame's color writes visible to the copy
+        VkImageMemoryBarrier imageBarrier;
+
+        imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.pNext = nullptr;
+        imageBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image = swapChainImages[lastSubmittedImage];
+        imageBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        // Set the buffer memory barrier info, which makes the copy's writes visible to the host
+        VkBufferMemoryBarrier bufferBarrier;
+
+        bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bufferBarrier.pNext = nullptr;
+        bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        bufferBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.buffer = readbackBuffer;
+        bufferBarrier.offset = 0;
+        bufferBarrier.size = size;
+
+        // Copy the image into the buffer and wait for the copy to finish
+        VkCommandBuffer commandBuffer = BeginSingleTimeCommands();
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+        CopyImageToBuffer(swapChainImages[lastSubmittedImage], readbackBuffer, swapChainExtent.width, swapChainExtent.height, 1, commandBuffer);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+
+        EndSingleTimeCommands(commandBuffer);
+
+        // Copy the buffer's contents into the given pixels
+        memcpy(pixels, readbackBufferAllocation.mappedMemory, (size_t)size);
+
+        return true;
+    }
 }
\ No newline at end of file
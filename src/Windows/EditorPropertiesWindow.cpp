@@ -1,15 +1,79 @@
 #include "Base/Window.hpp"
 #include "EditorPlatform/Platform.hpp"
+#include "General/Application.hpp"
+#include "Vulkan/SwapChain.hpp"
 
 namespace wfe::editor {
     // Constants
     const size_t MAX_PATH_LENGTH = 256;
+    const VkPresentModeKHR PRESENT_MODES[] = { VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_FIFO_RELAXED_KHR, VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR };
+    const char_t* PRESENT_MODE_LABELS[] = { "FIFO (VSync)", "FIFO relaxed", "Mailbox", "Immediate" };
+
+    const char_t* PRESENT_MODE_PROPERTY = "presentmode=";
+    const char_t* IMAGE_COUNT_PROPERTY = "swapchainimages=";
+    const char_t* TARGET_FRAME_RATE_PROPERTY = "targetfps=";
 
     // Variables
     string defaultTemplateLocation = "";
     string defaultProjectLocation = "";
     vector<string> templateLocations{};
 
+    // The saved display settings; the console args may override the ones in use without changing these
+    VkPresentModeKHR presentModeProperty = VK_PRESENT_MODE_MAILBOX_KHR;
+    uint32_t imageCountProperty = 0;
+    uint32_t targetFrameRateProperty = 0;
+
+    // Internal helper functions
+    static bool8_t ReadDisplayProperty(const string& line) {
+        size_t presentModePropertyLength = strlen(PRESENT_MODE_PROPERTY);
+        size_t imageCountPropertyLength = strlen(IMAGE_COUNT_PROPERTY);
+        size_t targetFrameRatePropertyLength = strlen(TARGET_FRAME_RATE_PROPERTY);
+
+        if(!strncmp(line.c_str(), PRESENT_MODE_PROPERTY, presentModePropertyLength)) {
+            if(StringToPresentMode(line.c_str() + presentModePropertyLength, presentModeProperty))
+                SetPreferredPresentMode(presentModeProperty);
+            return true;
+        }
+        if(!strncmp(line.c_str(), IMAGE_COUNT_PROPERTY, imageCountPropertyLength)) {
+            imageCountProperty = (uint32_t)strtoul(line.c_str() + imageCountPropertyLength, nullptr, 10);
+            SetPreferredImageCount(imageCountProperty);
+            return true;
+        }
+        if(!strncmp(line.c_str(), TARGET_FRAME_RATE_PROPERTY, targetFrameRatePropertyLength)) {
+            targetFrameRateProperty = (uint32_t)strtoul(line.c_str() + targetFrameRatePropertyLength, nullptr, 10);
+            SetTargetFrameRate(targetFrameRateProperty);
+            return true;
+        }
+
+        return false;
+    }
+    static void RenderDisplayProperties() {
+        // Display the present mode combo
+        int32_t presentModeIndex = 0;
+        for(int32_t i = 0; i < (int32_t)(sizeof(PRESENT_MODES) / sizeof(PRESENT_MODES[0])); ++i)
+            if(PRESENT_MODES[i] == GetPreferredPresentMode())
+                presentModeIndex = i;
+        
+        if(ImGui::Combo("Present mode##presentModeCombo", &presentModeIndex, PRESENT_MODE_LABELS, (int32_t)(sizeof(PRESENT_MODES) / sizeof(PRESENT_MODES[0])))) {
+            presentModeProperty = PRESENT_MODES[presentModeIndex];
+            SetPreferredPresentMode(presentModeProperty);
+        }
+
+        // Display the swap chain image count input
+        int32_t imageCount = (int32_t)GetPreferredImageCount();
+        if(ImGui::InputInt("Swap chain images (0 for default)##imageCountInput", &imageCount, 1, 1, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            imageCountProperty = imageCount > 0 ? (uint32_t)imageCount : 0;
+            SetPreferredImageCount(imageCountProperty);
+        }
+
+        // Display the target frame rate input
+        int32_t targetFrameRate = (int32_t)GetTargetFrameRate();
+        if(ImGui::InputInt("Frame rate limit (0 for uncapped)##targetFrameRateInput", &targetFrameRate, 10, 60)) {
+            targetFrameRateProperty = targetFrameRate > 0 ? (uint32_t)targetFrameRate : 0;
+            SetTargetFrameRate(targetFrameRateProperty);
+        }
+    }
+
     // Public functions
     static void RenderWindow() {
         WindowType& windowType = WindowType::windowTypes->at("Editor Properties");
@@ -52,6 +116,9 @@ namespace wfe::editor {
             ImGui::InputText("Default project path##defaultProjectLocationInput", defaultProjectLocationBuffer, MAX_PATH_LENGTH);
             defaultProjectLocation = defaultProjectLocationBuffer;
 
+            // Display the display settings
+            RenderDisplayProperties();
+
             // Display the list of templates
             if(ImGui::BeginListBox("Templates##templatesListBox", ImVec2(0.f, 200.f))) {
                 ImGui::PushItemWidth(-.01f);
@@ -107,11 +174,11 @@ namespace wfe::editor {
         input.ReadLine(defaultTemplateLocation, defaultTemplateLocation.max_size());
         input.ReadLine(defaultProjectLocation, defaultProjectLocation.max_size());
 
-        // Input every template path
+        // Input every display setting and template path
         while(!input.IsAtTheEnd()) {
             string line;
             input.ReadLine(line, line.max_size());
-            if(line.length())
+            if(line.length() && !ReadDisplayProperty(line))
                 templateLocations.push_back(line);
         }
 
@@ -124,6 +191,11 @@ namespace wfe::editor {
         output.Write(defaultTemplateLocation); output.WriteBuffer('\n');
         output.Write(defaultProjectLocation);  output.WriteBuffer('\n');
 
+        // Output the display settings
+        output.Write((string)PRESENT_MODE_PROPERTY + PresentModeToString(presentModeProperty)); output.WriteBuffer('\n');
+        output.Write((string)IMAGE_COUNT_PROPERTY + ToString(imageCountProperty));             output.WriteBuffer('\n');
+        output.Write((string)TARGET_FRAME_RATE_PROPERTY + ToString(targetFrameRateProperty));  output.WriteBuffer('\n');
+
         // Output every template path
         for(const auto& templateLocation : templateLocations) {
             output.Write(templateLocation); output.WriteBuffer('\n');
@@ -0,0 +1,60 @@
+#include "Base/Window.hpp"
+#include "Vulkan/GPUTimings.hpp"
+
+namespace wfe::editor {
+    // Variables
+    vector<GPUTiming> displayedGPUTimings;
+    WindowRefreshTimer gpuTimingsRefreshTimer{};
+
+    // Public functions
+    static void RenderWindow() {
+        WindowType& windowType = WindowType::windowTypes->at("GPU Timings");
+
+        ImGui::SetNextWindowSize(ImVec2(400.f, 300.f), ImGuiCond_FirstUseEver);
+        if(ImGui::Begin("GPU Timings", &windowType.open)) {
+            if(!AreGPUTimingsSupported()) {
+                ImGui::TextUnformatted("The GPU doesn't support timestamps on the graphics queue.");
+                ImGui::End();
+                return;
+            }
+
+            // Display the per window timing toggle
+            bool8_t windowTimings = AreWindowGPUTimingsEnabled();
+            if(ImGui::Checkbox("Time every window##windowTimingsCheckbox", &windowTimings)) {
+                if(windowTimings)
+                    EnableWindowGPUTimings();
+                else
+                    DisableWindowGPUTimings();
+            }
+
+            // Refresh the displayed timings periodically
+            if(ShouldRefreshWindow(gpuTimingsRefreshTimer))
+                displayedGPUTimings = GetGPUTimings();
+
+            // Display every timing, indented by its depth
+            if(ImGui::BeginTable("##gpuTimingsTable", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+                ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Time (ms)", ImGuiTableColumnFlags_WidthFixed, 80.f);
+                ImGui::TableHeadersRow();
+
+                for(const auto& timing : displayedGPUTimings) {
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    ImGui::Indent(timing.depth * ImGui::GetStyle().IndentSpacing + 1.f);
+                    ImGui::TextUnformatted(timing.name.c_str());
+                    ImGui::Unindent(timing.depth * ImGui::GetStyle().IndentSpacing + 1.f);
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", timing.duration);
+                }
+
+                ImGui::EndTable();
+            }
+        }
+
+        ImGui::End();
+    }
+
+    WFE_EDITOR_WINDOW_TYPE("GPU Timings", RenderWindow)
+}
@@ -0,0 +1,70 @@
+#include "Base/Window.hpp"
+#include "Vulkan/HostAllocator.hpp"
+
+namespace wfe::editor {
+    // Variables
+    HostAllocatorStats displayedHostAllocatorStats{};
+    WindowRefreshTimer hostMemoryRefreshTimer{};
+
+    // Public functions
+    static void RenderWindow() {
+        WindowType& windowType = WindowType::windowTypes->at("Host Memory");
+
+        ImGui::SetNextWindowSize(ImVec2(500.f, 250.f), ImGuiCond_FirstUseEver);
+        if(ImGui::Begin("Host Memory", &windowType.open)) {
+            if(!IsHostAllocatorEnabled()) {
+                ImGui::TextUnformatted("Vulkan uses the driver's host allocator, which isn't tracked.");
+                ImGui::End();
+                return;
+            }
+
+            // Refresh the displayed stats periodically
+            if(ShouldRefreshWindow(hostMemoryRefreshTimer))
+                displayedHostAllocatorStats = GetHostAllocatorStats();
+
+            // Display the command scope allocation rate
+            const HostAllocatorStats& stats = displayedHostAllocatorStats;
+
+            ImGui::Text("Command allocations last frame: %zu (%zu bytes)", stats.frameCommandAllocationCount, stats.frameCommandAllocationSize);
+            ImGui::Text("Command allocations per frame: %.1f (%.1f bytes)", stats.averageFrameCommandAllocationCount, stats.averageFrameCommandAllocationSize);
+            ImGui::Text("Command arena chunks: %zu", stats.arenaChunkCount);
+            ImGui::Separator();
+
+            // Display every scope's stats
+            if(ImGui::BeginTable("##hostMemoryTable", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+                ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Live (KiB)", ImGuiTableColumnFlags_WidthFixed, 80.f);
+                ImGui::TableSetupColumn("Peak (KiB)", ImGuiTableColumnFlags_WidthFixed, 80.f);
+                ImGui::TableSetupColumn("Live", ImGuiTableColumnFlags_WidthFixed, 60.f);
+                ImGui::TableSetupColumn("Total", ImGuiTableColumnFlags_WidthFixed, 80.f);
+                ImGui::TableSetupColumn("Internal (KiB)", ImGuiTableColumnFlags_WidthFixed, 90.f);
+                ImGui::TableHeadersRow();
+
+                for(size_t i = 0; i < HOST_ALLOCATION_SCOPE_COUNT; ++i) {
+                    const HostAllocationScopeStats& scope = stats.scopes[i];
+
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(HostAllocationScopeToString((VkSystemAllocationScope)i));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", scope.liveSize / 1024.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", scope.peakSize / 1024.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", scope.liveCount);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", scope.allocationCount);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", scope.internalSize / 1024.0);
+                }
+
+                ImGui::EndTable();
+            }
+        }
+
+        ImGui::End();
+    }
+
+    WFE_EDITOR_WINDOW_TYPE("Host Memory", RenderWindow)
+}
@@ -0,0 +1,107 @@
+#include "Base/Window.hpp"
+#include "General/Profiler.hpp"
+
+#include <algorithm>
+
+namespace wfe::editor {
+    // Constants
+    const char_t* PROFILER_TRACE_FILENAME = "trace.json";
+
+    // Variables
+    vector<ProfilerZoneInfo> displayedZones;
+    float64_t displayedFrameDuration = 0.0;
+    WindowRefreshTimer profilerRefreshTimer{};
+    bool profilerPaused = false;
+    string traceExportStatus = "";
+
+    // Internal helper functions
+    static ImU32 GetZoneColor(const char_t* name) {
+        // Hash the name, so every zone keeps its color between frames
+        uint32_t hash = 2166136261u;
+        for(; *name; ++name)
+            hash = (hash ^ (uint8_t)*name) * 16777619u;
+
+        return IM_COL32(96 + (hash & 0x7f), 96 + ((hash >> 8) & 0x7f), 96 + ((hash >> 16) & 0x7f), 255);
+    }
+    static void RenderFlameGraph() {
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        float32_t rowHeight = ImGui::GetTextLineHeightWithSpacing();
+        float32_t graphWidth = ImGui::GetContentRegionAvail().x;
+        float32_t msToPixels = displayedFrameDuration > 0.0 ? graphWidth / (float32_t)displayedFrameDuration : 0.f;
+
+        // Draw every thread's zones in its own band, one row for every depth
+        for(size_t first = 0; first < displayedZones.size();) {
+            uint32_t threadIndex = displayedZones[first].threadIndex;
+
+            size_t last = first;
+            uint32_t maxDepth = 0;
+            for(; last < displayedZones.size() && displayedZones[last].threadIndex == threadIndex; ++last)
+                if(displayedZones[last].depth > maxDepth)
+                    maxDepth = displayedZones[last].depth;
+
+            ImGui::TextUnformatted(GetProfilerThreadName(threadIndex));
+
+            ImVec2 bandPos = ImGui::GetCursorScreenPos();
+            ImGui::Dummy(ImVec2(graphWidth, rowHeight * (maxDepth + 1)));
+
+            for(size_t i = first; i < last; ++i) {
+                const ProfilerZoneInfo& zone = displayedZones[i];
+
+                ImVec2 zoneMin(bandPos.x + (float32_t)zone.start * msToPixels, bandPos.y + zone.depth * rowHeight);
+                ImVec2 zoneMax(zoneMin.x + std::max((float32_t)zone.duration * msToPixels, 1.f), zoneMin.y + rowHeight - 1.f);
+
+                drawList->AddRectFilled(zoneMin, zoneMax, GetZoneColor(zone.name));
+
+                // Only label the zones wide enough to hold some text
+                if(zoneMax.x - zoneMin.x > 8.f) {
+                    ImVec4 clipRect(zoneMin.x, zoneMin.y, zoneMax.x, zoneMax.y);
+                    drawList->AddText(nullptr, 0.f, ImVec2(zoneMin.x + 2.f, zoneMin.y), IM_COL32_BLACK, zone.name, nullptr, 0.f, &clipRect);
+                }
+
+                if(ImGui::IsMouseHoveringRect(zoneMin, zoneMax))
+                    ImGui::SetTooltip("%s\n%.3f ms", zone.name, zone.duration);
+            }
+
+            first = last;
+        }
+    }
+
+    // Public functions
+    static void RenderWindow() {
+        WindowType& windowType = WindowType::windowTypes->at("Profiler");
+
+        ImGui::SetNextWindowSize(ImVec2(600.f, 300.f), ImGuiCond_FirstUseEver);
+        if(ImGui::Begin("Profiler", &windowType.open)) {
+#if !WFE_ENABLE_PROFILER
+            ImGui::TextUnformatted("The profiler's zones were compiled out of this build.");
+#endif
+            ImGui::Checkbox("Pause##profilerPauseCheckbox", &profilerPaused);
+            ImGui::SameLine();
+            if(ImGui::Button("Export trace##profilerExportButton")) {
+                if(ExportProfilerTrace(PROFILER_TRACE_FILENAME))
+                    traceExportStatus = (string)"Exported trace to " + PROFILER_TRACE_FILENAME + ".";
+                else
+                    traceExportStatus = (string)"Failed to export trace to " + PROFILER_TRACE_FILENAME + "!";
+            }
+            if(traceExportStatus.length()) {
+                ImGui::SameLine();
+                ImGui::TextUnformatted(traceExportStatus.c_str());
+            }
+
+            // Refresh the displayed frame periodically, unless the profiler is paused
+            if(!profilerPaused && ShouldRefreshWindow(profilerRefreshTimer))
+                displayedFrameDuration = GetLastProfilerFrame(displayedZones);
+
+            ImGui::Text("Frame time: %.3f ms", displayedFrameDuration);
+            ImGui::Separator();
+
+            if(ImGui::BeginChild("##profilerFlameGraph"))
+                RenderFlameGraph();
+            ImGui::EndChild();
+        }
+
+        ImGui::End();
+    }
+
+    WFE_EDITOR_WINDOW_TYPE("Profiler", RenderWindow)
+}
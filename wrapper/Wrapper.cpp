@@ -55,6 +55,10 @@ namespace wfe::editor {
     void CloseWorkspace() {
         editorCallbacks.closeWorkspace();
     }
+
+    bool8_t ShouldRefreshWindow(WindowRefreshTimer& timer, float64_t interval) {
+        return editorCallbacks.shouldRefreshWindow(timer, interval);
+    }
     
     vector<Event> GetEvents() {
         return editorCallbacks.getEvents();
@@ -70,11 +74,25 @@ namespace wfe::editor {
     void CloseApplication(int32_t returnCode) {
         editorCallbacks.closeApplication(returnCode);
     }
+    void RequestContinuousUpdates() {
+        editorCallbacks.requestContinuousUpdates();
+    }
+    uint32_t GetTargetFrameRate() {
+        return editorCallbacks.getTargetFrameRate();
+    }
+    void SetTargetFrameRate(uint32_t newTargetFrameRate) {
+        editorCallbacks.setTargetFrameRate(newTargetFrameRate);
+    }
     bool8_t IsInsideEditor() {
         if(editorCallbacks.isInsideEditor)
             return editorCallbacks.isInsideEditor();
         return false;
     }
+    bool8_t IsHeadless() {
+        if(editorCallbacks.isHeadless)
+            return editorCallbacks.isHeadless();
+        return false;
+    }
 
     size_t GetMainWindowWidth() {
         return editorCallbacks.getMainWindowWidth();
@@ -99,6 +117,9 @@ namespace wfe::editor {
     void PorcessImGuiEvents() {
         editorCallbacks.processImGuiEvents();
     }
+    float64_t GetImGuiIdleTimeout() {
+        return editorCallbacks.getImGuiIdleTimeout();
+    }
 
     ImGuiContext* GetImGuiContext() {
         return editorCallbacks.getImGuiContext();
@@ -120,6 +141,49 @@ namespace wfe::editor {
         return editorCallbacks.getImGuiItalicFont();
     }
 
+    void CreateThreadPool() {
+        editorCallbacks.createThreadPool();
+    }
+    void DeleteThreadPool() {
+        editorCallbacks.deleteThreadPool();
+    }
+
+    size_t GetWorkerThreadCount() {
+        return editorCallbacks.getWorkerThreadCount();
+    }
+    void ParallelFor(size_t count, ParallelForFunction function, void* userData) {
+        editorCallbacks.parallelFor(count, function, userData);
+    }
+
+    bool8_t WritePNGFile(const string& filename, size_t width, size_t height, const void* data) {
+        return editorCallbacks.writePNGFile(filename, width, height, data);
+    }
+
+    void SetProfilerThreadName(const char_t* name) {
+        editorCallbacks.setProfilerThreadName(name);
+    }
+    size_t GetProfilerThreadCount() {
+        return editorCallbacks.getProfilerThreadCount();
+    }
+    const char_t* GetProfilerThreadName(size_t threadIndex) {
+        return editorCallbacks.getProfilerThreadName(threadIndex);
+    }
+    const char_t* InternProfilerName(const char_t* name) {
+        return editorCallbacks.internProfilerName(name);
+    }
+    void BeginProfilerZone(const char_t* name) {
+        editorCallbacks.beginProfilerZone(name);
+    }
+    void EndProfilerZone() {
+        editorCallbacks.endProfilerZone();
+    }
+    float64_t GetLastProfilerFrame(vector<ProfilerZoneInfo>& zones) {
+        return editorCallbacks.getLastProfilerFrame(zones);
+    }
+    bool8_t ExportProfilerTrace(const string& filename) {
+        return editorCallbacks.exportProfilerTrace(filename);
+    }
+
     void CreatePlatform() {
         editorCallbacks.createPlatform();
     }
@@ -129,6 +193,12 @@ namespace wfe::editor {
     void PollPlatformEvents() {
         editorCallbacks.pollPlatformEvents();
     }
+    void WaitPlatformEvents(float64_t timeout) {
+        editorCallbacks.waitPlatformEvents(timeout);
+    }
+    void WakePlatform() {
+        editorCallbacks.wakePlatform();
+    }
 
     PlatformInfo* GetPlatformInfo() {
         return editorCallbacks.getPlatformInfo();
@@ -179,12 +249,39 @@ namespace wfe::editor {
     VkQueue GetPresentQueue() {
         return editorCallbacks.getPresentQueue();
     }
+    VkQueue GetTransferQueue() {
+        return editorCallbacks.getTransferQueue();
+    }
+    VkResult SubmitToQueue(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence) {
+        return editorCallbacks.submitToQueue(queue, submitCount, submits, fence);
+    }
+    void WaitForQueueIdle(VkQueue queue) {
+        editorCallbacks.waitForQueueIdle(queue);
+    }
+    void WaitForDeviceIdle() {
+        editorCallbacks.waitForDeviceIdle();
+    }
+    VkPipelineCache GetPipelineCache() {
+        return editorCallbacks.getPipelineCache();
+    }
     const VkPhysicalDeviceProperties& GetPhysicalDeviceProperties() {
         return editorCallbacks.getPhysicalDeviceProperties();
     }
     const VkPhysicalDeviceFeatures& GetPhysicalDeviceFeatures() {
         return editorCallbacks.getPhysicalDeviceFeatures();
     }
+    const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& GetDescriptorIndexingFeatures() {
+        return editorCallbacks.getDescriptorIndexingFeatures();
+    }
+    bool8_t IsDeviceExtensionEnabled(const char_t* extensionName) {
+        return editorCallbacks.isDeviceExtensionEnabled(extensionName);
+    }
+    bool8_t IsDynamicRenderingSupported() {
+        return editorCallbacks.isDynamicRenderingSupported();
+    }
+    bool8_t IsTimelineSemaphoreSupported() {
+        return editorCallbacks.isTimelineSemaphoreSupported();
+    }
     bool8_t AreValidationLayersEnabled() {
         return editorCallbacks.areValidationLayersEnabled();
     }
@@ -215,12 +312,72 @@ namespace wfe::editor {
     void CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) {
         editorCallbacks.createImage(imageInfo, properties, image, imageMemory);
     }
+    void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, MemoryAllocation& bufferAllocation) {
+        editorCallbacks.createBufferAllocation(size, usage, properties, buffer, bufferAllocation);
+    }
+    void CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image, MemoryAllocation& imageAllocation) {
+        editorCallbacks.createImageAllocation(imageInfo, properties, image, imageAllocation);
+    }
+    uint64_t UploadImageData(VkImage image, uint32_t width, uint32_t height, const void* data, VkDeviceSize size) {
+        return editorCallbacks.uploadImageData(image, width, height, data, size);
+    }
+    void SubmitUploads() {
+        editorCallbacks.submitUploads();
+    }
+    bool8_t IsUploadComplete(uint64_t upload) {
+        return editorCallbacks.isUploadComplete(upload);
+    }
+    void WaitForUpload(uint64_t upload) {
+        editorCallbacks.waitForUpload(upload);
+    }
+    bool8_t HasPendingUploads() {
+        return editorCallbacks.hasPendingUploads();
+    }
+    void DeferDestroyBuffer(VkBuffer buffer) {
+        editorCallbacks.deferDestroyBuffer(buffer);
+    }
+    void DeferDestroyImage(VkImage image) {
+        editorCallbacks.deferDestroyImage(image);
+    }
+    void DeferDestroyImageView(VkImageView imageView) {
+        editorCallbacks.deferDestroyImageView(imageView);
+    }
+    void DeferFreeMemory(VkDeviceMemory memory) {
+        editorCallbacks.deferFreeMemory(memory);
+    }
+    void DeferFreeMemory(const MemoryAllocation& allocation) {
+        editorCallbacks.deferFreeMemoryAllocation(allocation);
+    }
+    void DeferFreeDescriptorSet(VkDescriptorPool descriptorPool, VkDescriptorSet descriptorSet) {
+        editorCallbacks.deferFreeDescriptorSet(descriptorPool, descriptorSet);
+    }
+    void DeferDestroyPipeline(VkPipeline pipeline) {
+        editorCallbacks.deferDestroyPipeline(pipeline);
+    }
+    size_t GetDeferredDeletionCount() {
+        return editorCallbacks.getDeferredDeletionCount();
+    }
+    VkCommandBuffer BeginCommandBatch() {
+        return editorCallbacks.beginCommandBatch();
+    }
+    uint64_t SubmitCommandBatch(VkCommandBuffer commandBuffer) {
+        return editorCallbacks.submitCommandBatch(commandBuffer);
+    }
+    bool8_t IsCommandBatchComplete(uint64_t batch) {
+        return editorCallbacks.isCommandBatchComplete(batch);
+    }
+    void WaitForCommandBatch(uint64_t batch) {
+        editorCallbacks.waitForCommandBatch(batch);
+    }
     VkCommandBuffer BeginSingleTimeCommands() {
         return editorCallbacks.beginSingleTimeCommands();
     }
     void EndSingleTimeCommands(VkCommandBuffer commandBuffer) {
         editorCallbacks.endSingleTimeCommands(commandBuffer);
     }
+    VkCommandBuffer AllocateFrameCommandBuffer(uint32_t frameIndex) {
+        return editorCallbacks.allocateFrameCommandBuffer(frameIndex);
+    }
     void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkCommandBuffer commandBuffer) {
         editorCallbacks.copyBuffer(srcBuffer, dstBuffer, size, commandBuffer);
     }
@@ -250,6 +407,31 @@ namespace wfe::editor {
     void DrawImGui() {
         editorCallbacks.drawImGui();
     }
+    bool8_t HasImGuiFrameChanged() {
+        return editorCallbacks.hasImGuiFrameChanged();
+    }
+    void RequestRedraw() {
+        editorCallbacks.requestRedraw();
+    }
+
+    bool8_t IsPresentOnChangeEnabled() {
+        return editorCallbacks.isPresentOnChangeEnabled();
+    }
+    void EnablePresentOnChange() {
+        editorCallbacks.enablePresentOnChange();
+    }
+    void DisablePresentOnChange() {
+        editorCallbacks.disablePresentOnChange();
+    }
+    bool8_t IsBindlessRenderingEnabled() {
+        return editorCallbacks.isBindlessRenderingEnabled();
+    }
+    void EnableBindlessRendering() {
+        editorCallbacks.enableBindlessRendering();
+    }
+    void DisableBindlessRendering() {
+        editorCallbacks.disableBindlessRendering();
+    }
 
     VkPipeline GetImGuiPipeline() {
         return editorCallbacks.getImGuiPipeline();
@@ -260,10 +442,79 @@ namespace wfe::editor {
     VkCommandBuffer GetImGuiCommandBuffer() {
         return editorCallbacks.getImGuiCommandBuffer();
     }
+    const ImGuiPipelineStats& GetImGuiPipelineStats() {
+        return editorCallbacks.getImGuiPipelineStats();
+    }
 
-    ImTextureID GetImGuiTexture(ImageID imageId) {
+    ImGuiTextureRegion GetImGuiTexture(ImageID imageId) {
         return editorCallbacks.getImGuiTexture(imageId);
     }
+    void LoadImGuiIcons(size_t count, const char_t* const* filenames, ImGuiTextureRegion* regions) {
+        editorCallbacks.loadImGuiIcons(count, filenames, regions);
+    }
+    ImTextureID RegisterImGuiTexture(size_t width, size_t height, const void* data) {
+        return editorCallbacks.registerImGuiTexture(width, height, data);
+    }
+    void LoadImGuiTextures(size_t count, const char_t* const* filenames, ImTextureID* textureIds) {
+        editorCallbacks.loadImGuiTextures(count, filenames, textureIds);
+    }
+    void LoadImGuiTexturesFromMemory(size_t count, const void* const* encodedData, const size_t* encodedSizes, ImTextureID* textureIds) {
+        editorCallbacks.loadImGuiTexturesFromMemory(count, encodedData, encodedSizes, textureIds);
+    }
+    void UpdateImGuiTexture(ImTextureID textureId, size_t width, size_t height, const void* data) {
+        editorCallbacks.updateImGuiTexture(textureId, width, height, data);
+    }
+    void ReleaseImGuiTexture(ImTextureID textureId) {
+        editorCallbacks.releaseImGuiTexture(textureId);
+    }
+
+    bool8_t AreGPUTimingsSupported() {
+        return editorCallbacks.areGPUTimingsSupported();
+    }
+    bool8_t AreWindowGPUTimingsEnabled() {
+        return editorCallbacks.areWindowGPUTimingsEnabled();
+    }
+    void EnableWindowGPUTimings() {
+        editorCallbacks.enableWindowGPUTimings();
+    }
+    void DisableWindowGPUTimings() {
+        editorCallbacks.disableWindowGPUTimings();
+    }
+
+    uint32_t BeginGPUScope(VkCommandBuffer commandBuffer, const char_t* name) {
+        return editorCallbacks.beginGPUScope(commandBuffer, name);
+    }
+    void EndGPUScope(VkCommandBuffer commandBuffer, uint32_t scope) {
+        editorCallbacks.endGPUScope(commandBuffer, scope);
+    }
+
+    const vector<GPUTiming>& GetGPUTimings() {
+        return editorCallbacks.getGPUTimings();
+    }
+
+    void AllocateMemory(const VkMemoryRequirements& memoryRequirements, VkMemoryPropertyFlags properties, bool8_t linear, MemoryAllocation& allocation) {
+        editorCallbacks.allocateMemory(memoryRequirements, properties, linear, allocation);
+    }
+    void FreeMemory(MemoryAllocation& allocation) {
+        editorCallbacks.freeMemory(allocation);
+    }
+    void FlushMemory(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) {
+        editorCallbacks.flushMemory(allocation, offset, size);
+    }
+
+    MemoryAllocatorStats GetMemoryAllocatorStats() {
+        return editorCallbacks.getMemoryAllocatorStats();
+    }
+
+    bool8_t IsHostAllocatorEnabled() {
+        return editorCallbacks.isHostAllocatorEnabled();
+    }
+    HostAllocatorStats GetHostAllocatorStats() {
+        return editorCallbacks.getHostAllocatorStats();
+    }
+    const char_t* HostAllocationScopeToString(VkSystemAllocationScope scope) {
+        return editorCallbacks.hostAllocationScopeToString(scope);
+    }
 
     void CreateSwapChain() {
         editorCallbacks.createSwapChain();
@@ -274,6 +525,59 @@ namespace wfe::editor {
     void RecreateSwapChain() {
         editorCallbacks.recreateSwapChain();
     }
+    void RequestSwapChainRecreation() {
+        editorCallbacks.requestSwapChainRecreation();
+    }
+    bool8_t IsSwapChainRecreationPending() {
+        return editorCallbacks.isSwapChainRecreationPending();
+    }
+    bool8_t UpdateSwapChain() {
+        return editorCallbacks.updateSwapChain();
+    }
+    const SwapChainStats& GetSwapChainStats() {
+        return editorCallbacks.getSwapChainStats();
+    }
+    const SwapChainAttachmentInfo& GetSwapChainAttachmentInfo() {
+        return editorCallbacks.getSwapChainAttachmentInfo();
+    }
+    void SetSwapChainAttachmentInfo(const SwapChainAttachmentInfo& attachmentInfo) {
+        editorCallbacks.setSwapChainAttachmentInfo(attachmentInfo);
+    }
+    uint32_t GetSwapChainAttachmentCount() {
+        return editorCallbacks.getSwapChainAttachmentCount();
+    }
+    bool8_t IsDynamicRenderingEnabled() {
+        return editorCallbacks.isDynamicRenderingEnabled();
+    }
+    const VkPipelineRenderingCreateInfoKHR* GetPipelineRenderingCreateInfo() {
+        return editorCallbacks.getPipelineRenderingCreateInfo();
+    }
+    void BeginSwapChainRendering(VkCommandBuffer commandBuffer, uint32_t imageIndex, const VkClearValue* clearValues) {
+        editorCallbacks.beginSwapChainRendering(commandBuffer, imageIndex, clearValues);
+    }
+    void EndSwapChainRendering(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+        editorCallbacks.endSwapChainRendering(commandBuffer, imageIndex);
+    }
+
+    bool8_t IsTimelineSemaphoreEnabled() {
+        return editorCallbacks.isTimelineSemaphoreEnabled();
+    }
+    VkSemaphore GetFrameTimelineSemaphore() {
+        return editorCallbacks.getFrameTimelineSemaphore();
+    }
+    uint64_t GetSubmittedFrameValue() {
+        return editorCallbacks.getSubmittedFrameValue();
+    }
+    uint64_t GetCompletedFrameValue() {
+        return editorCallbacks.getCompletedFrameValue();
+    }
+    bool8_t HasGPUReachedFrame(uint64_t value) {
+        return editorCallbacks.hasGPUReachedFrame(value);
+    }
+    void WaitForFrame(uint64_t value) {
+        editorCallbacks.waitForFrame(value);
+    }
+
     VkFramebuffer GetFrameBuffer(size_t index) {
         return editorCallbacks.getFrameBuffer(index);
     }
@@ -301,6 +605,27 @@ namespace wfe::editor {
     uint32_t GetCurrentFrame() {
         return editorCallbacks.getCurrentFrame();
     }
+    VkPresentModeKHR GetPresentMode() {
+        return editorCallbacks.getPresentMode();
+    }
+    VkPresentModeKHR GetPreferredPresentMode() {
+        return editorCallbacks.getPreferredPresentMode();
+    }
+    void SetPreferredPresentMode(VkPresentModeKHR presentMode) {
+        editorCallbacks.setPreferredPresentMode(presentMode);
+    }
+    uint32_t GetPreferredImageCount() {
+        return editorCallbacks.getPreferredImageCount();
+    }
+    void SetPreferredImageCount(uint32_t imageCount) {
+        editorCallbacks.setPreferredImageCount(imageCount);
+    }
+    const char_t* PresentModeToString(VkPresentModeKHR presentMode) {
+        return editorCallbacks.presentModeToString(presentMode);
+    }
+    bool8_t StringToPresentMode(const char_t* name, VkPresentModeKHR& presentMode) {
+        return editorCallbacks.stringToPresentMode(name, presentMode);
+    }
 
     float32_t ExtentAspectRatio() {
         return editorCallbacks.extentAspectRatio();
@@ -312,9 +637,15 @@ namespace wfe::editor {
     VkResult AcquireNextImage(uint32_t* imageIndex) {
         return editorCallbacks.acquireNextImage(imageIndex);
     }
+    void QueueFrameCommandBuffer(VkCommandBuffer commandBuffer) {
+        editorCallbacks.queueFrameCommandBuffer(commandBuffer);
+    }
     VkResult SubmitCommandBuffers(const VkCommandBuffer* buffers, uint32_t* imageIndex, uint32_t bufferCount) {
         return editorCallbacks.submitCommandBuffers(buffers, imageIndex, bufferCount);
     }
+    bool8_t ReadLastFramePixels(void* pixels) {
+        return editorCallbacks.readLastFramePixels(pixels);
+    }
 
     void LoadEditorProperties() {
         editorCallbacks.loadEditorProperties();